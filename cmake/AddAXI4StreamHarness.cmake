@@ -0,0 +1,64 @@
+# Copyright 2018 Tymoteusz Blazejczyk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+if (COMMAND add_axi4_stream_harness)
+    return()
+endif()
+
+if (NOT DEFINED AXI4_STREAM_HARNESS_DIR)
+    get_filename_component(AXI4_STREAM_HARNESS_DIR
+        "${CMAKE_CURRENT_LIST_DIR}/../tests/logic/axi4/stream/harness"
+        ABSOLUTE)
+
+    set(AXI4_STREAM_HARNESS_DIR "${AXI4_STREAM_HARNESS_DIR}" CACHE INTERNAL
+        "AXI4-Stream UVM-SystemC harness sources directory" FORCE)
+endif()
+
+include(CMakeParseArguments)
+include(AddHDLSystemCTest)
+
+# UVM-SystemC test of logic_axi4_stream_*_top module with single Rx and Tx
+# interface built from generic harness/main.cpp. Model ports are bound by
+# name, standard basic_test, long_test and coverage_test tests are always
+# registered. Extra SOURCES and TESTS are added to them, other arguments are
+# passed to add_hdl_systemc_test():
+#
+#   add_axi4_stream_harness(logic_axi4_stream_queue_top
+#       SOURCES replay_test.cpp
+#       TESTS replay_test
+#       PARAMETERS TDATA_BYTES=4
+#   )
+function(add_axi4_stream_harness hdl_name)
+    set(multi_value_arguments
+        TESTS
+        SOURCES
+    )
+
+    cmake_parse_arguments(ARG "" "" "${multi_value_arguments}" ${ARGN})
+
+    add_hdl_systemc_test(${hdl_name}
+        SOURCES
+            ${AXI4_STREAM_HARNESS_DIR}/main.cpp
+            ${AXI4_STREAM_HARNESS_DIR}/basic_test.cpp
+            ${AXI4_STREAM_HARNESS_DIR}/long_test.cpp
+            ${AXI4_STREAM_HARNESS_DIR}/coverage_test.cpp
+            ${ARG_SOURCES}
+        TESTS
+            basic_test
+            long_test
+            coverage_test
+            ${ARG_TESTS}
+        ${ARG_UNPARSED_ARGUMENTS}
+    )
+endfunction()
@@ -18,5 +18,7 @@ include(AddHDLModelSim)
 include(AddHDLQuartus)
 include(AddHDLVivado)
 include(AddHDLSystemC)
+include(AddHDLSystemCTest)
+include(AddAXI4StreamHarness)
 include(AddHDLVerilator)
 include(AddHDLUnitTest)
@@ -17,19 +17,32 @@ if (COMMAND add_hdl_systemc)
 endif()
 
 function(add_hdl_systemc target_name)
+    set(options
+        PGO
+        SAVABLE
+    )
+
     set(one_value_arguments
         NAME
         TARGET
+        OUTPUT
+        PROFILE
+        THREADS
+        THREADS_DPI
+        TRACE_FORMAT
+        TRACE_THREADS
     )
 
     set(multi_value_arguments
         DEFINES
         INCLUDES
         PARAMETERS
+        PGO_ARGS
+        PGO_SOURCES
         VERILATOR_CONFIGURATIONS
     )
 
-    cmake_parse_arguments(ARG "" "${one_value_arguments}"
+    cmake_parse_arguments(ARG "${options}" "${one_value_arguments}"
         "${multi_value_arguments}" ${ARGN})
 
     set(ARG_COMPILE Verilator)
@@ -0,0 +1,248 @@
+# Copyright 2018 Tymoteusz Blazejczyk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+if (COMMAND add_hdl_systemc_test)
+    return()
+endif()
+
+include(CMakeParseArguments)
+include(AddHDLSystemC)
+
+# Verilates HDL module and builds UVM-SystemC test executable for every
+# combination of PARAMETERS values. Parameter values are separated by commas:
+#
+#   add_hdl_systemc_test(logic_axi4_stream_queue_top
+#       SOURCES main.cpp basic_test.cpp
+#       TESTS basic_test
+#       PARAMETERS TDATA_BYTES=4,16,64 TID_WIDTH=1,8
+#   )
+#
+# Every combination appends swept parameters to <name> and <name>_test target
+# names, like <name>_tdata_bytes_64_tid_width_8, where <name> is NAME or HDL
+# module name. Names stay plain only when no parameter is swept. OUTPUT cc
+# builds C++ model for <logic::verilated_loop>. Every combination has own
+# working directory and CTest entries are labeled with systemc and all
+# parameters. BENCHMARK adds benchmark label and makes every test write
+# +logic_bench summary to <build>/benchmark/<test>.json, see
+# logic_benchmark_summary test.
+# Executable is compiled with LOGIC_MODEL=<target> and all parameters as
+# preprocessor definitions. SEEDS adds <target>_regression test that runs
+# all TESTS for every seed from one elaborated executable with
+# <logic::test_server>, seeds are given as values or <first>:<last> ranges.
+# SAVABLE verilates model with --savable for <logic::checkpoint>.
+function(add_hdl_systemc_test hdl_name)
+    set(options
+        SAVABLE
+        BENCHMARK
+    )
+
+    set(one_value_arguments
+        NAME
+        OUTPUT
+        PROFILE
+        THREADS
+    )
+
+    set(multi_value_arguments
+        ARGS
+        TESTS
+        LABELS
+        SEEDS
+        SOURCES
+        PARAMETERS
+    )
+
+    cmake_parse_arguments(ARG "${options}" "${one_value_arguments}"
+        "${multi_value_arguments}" ${ARGN})
+
+    if (NOT ARG_SOURCES)
+        message(FATAL_ERROR "No sources provided for ${hdl_name} test")
+    endif()
+
+    set(hdl_systemc_arguments "")
+
+    if (NOT ARG_NAME)
+        set(ARG_NAME ${hdl_name})
+    endif()
+
+    foreach (argument OUTPUT PROFILE THREADS)
+        if (ARG_${argument})
+            list(APPEND hdl_systemc_arguments ${argument} ${ARG_${argument}})
+        endif()
+    endforeach()
+
+    if (ARG_SAVABLE)
+        list(APPEND hdl_systemc_arguments SAVABLE)
+    endif()
+
+    set(swept "")
+    set(combinations "")
+
+    foreach (parameter ${ARG_PARAMETERS})
+        if (NOT parameter MATCHES "^([A-Za-z_][A-Za-z0-9_]*)=(.+)$")
+            message(FATAL_ERROR "Invalid parameter ${parameter} "
+                "for ${hdl_name}, use NAME=value[,value...]")
+        endif()
+
+        set(name ${CMAKE_MATCH_1})
+        string(REPLACE "," ";" values "${CMAKE_MATCH_2}")
+        list(REMOVE_DUPLICATES values)
+        list(LENGTH values count)
+
+        if (count GREATER 1)
+            list(APPEND swept ${name})
+        endif()
+
+        set(expanded "")
+
+        if (NOT combinations)
+            foreach (value ${values})
+                list(APPEND expanded "${name}=${value}")
+            endforeach()
+        else()
+            foreach (combination ${combinations})
+                foreach (value ${values})
+                    list(APPEND expanded "${combination}|${name}=${value}")
+                endforeach()
+            endforeach()
+        endif()
+
+        set(combinations ${expanded})
+    endforeach()
+
+    if (NOT combinations)
+        set(combinations "-")
+    endif()
+
+    set(benchmark_dir "${CMAKE_BINARY_DIR}/benchmark")
+
+    if (ARG_BENCHMARK)
+        file(MAKE_DIRECTORY "${benchmark_dir}")
+    endif()
+
+    foreach (combination ${combinations})
+        set(parameters "")
+
+        if (NOT combination STREQUAL "-")
+            string(REPLACE "|" ";" parameters "${combination}")
+        endif()
+
+        set(target ${ARG_NAME})
+
+        foreach (parameter ${parameters})
+            string(REGEX MATCH "^[^=]+" name "${parameter}")
+            list(FIND swept ${name} index)
+
+            if (index GREATER -1)
+                string(REGEX REPLACE "^[^=]+=" "" value "${parameter}")
+                string(MAKE_C_IDENTIFIER "${name}_${value}" suffix)
+                string(TOLOWER "${suffix}" suffix)
+                set(target ${target}_${suffix})
+            endif()
+        endforeach()
+
+        set(working_directory
+            "${CMAKE_BINARY_DIR}/systemc/unit_tests/${target}")
+
+        add_hdl_systemc(${hdl_name}
+            TARGET
+                ${target}
+            PARAMETERS
+                ${parameters}
+            ${hdl_systemc_arguments}
+        )
+
+        add_executable(${target}_test
+            ${ARG_SOURCES}
+        )
+
+        target_compile_definitions(${target}_test PRIVATE
+            ${parameters}
+            LOGIC_MODEL=${target}
+        )
+
+        set_target_properties(${target}_test PROPERTIES
+            RUNTIME_OUTPUT_DIRECTORY
+                "${working_directory}"
+        )
+
+        logic_target_compile_options(${target}_test
+            PRIVATE
+                $<$<CXX_COMPILER_ID:Clang>:-Wno-unused-member-function>
+        )
+
+        logic_target_link_libraries(${target}_test
+            logic
+            systemc-module-${target}
+        )
+
+        set(labels systemc ${ARG_LABELS} ${parameters})
+
+        if (ARG_BENCHMARK)
+            list(APPEND labels benchmark)
+        endif()
+
+        foreach (test ${ARG_TESTS})
+            set(benchmark_arguments "")
+
+            if (ARG_BENCHMARK)
+                set(benchmark_arguments
+                    +logic_bench=${benchmark_dir}/${target}_${test}.json)
+
+                set_property(GLOBAL APPEND PROPERTY LOGIC_BENCHMARK_TESTS
+                    ${target}_${test})
+            endif()
+
+            add_test(
+                NAME
+                    ${target}_${test}
+                COMMAND
+                    ${target}_test
+                    +UVM_TESTNAME=${test}
+                    +uvm_set_config_string=*,trace_filename,${target}_${test}
+                    ${benchmark_arguments}
+                    ${ARG_ARGS}
+                WORKING_DIRECTORY
+                    "${working_directory}"
+            )
+
+            set_tests_properties(${target}_${test} PROPERTIES
+                LABELS "${labels}"
+            )
+        endforeach()
+
+        if (ARG_SEEDS)
+            string(REPLACE ";" "," tests "${ARG_TESTS}")
+            string(REPLACE ";" "," seeds "${ARG_SEEDS}")
+
+            add_test(
+                NAME
+                    ${target}_regression
+                COMMAND
+                    ${target}_test
+                    +logic_tests=${tests}
+                    +logic_seeds=${seeds}
+                    +logic_report=${target}_regression.xml
+                    ${ARG_ARGS}
+                WORKING_DIRECTORY
+                    "${working_directory}"
+            )
+
+            set_tests_properties(${target}_regression PROPERTIES
+                LABELS "systemc;regression;${ARG_LABELS}"
+            )
+        endif()
+    endforeach()
+endfunction()
@@ -26,6 +26,18 @@ include(GetHDLDepends)
 find_package(SystemC REQUIRED COMPONENTS SCV UVM)
 find_package(Verilator)
 
+set(LOGIC_VERILATOR_PROFILE coverage CACHE STRING
+    "Default Verilator build profile: debug, fast-sim or coverage")
+
+set_property(CACHE LOGIC_VERILATOR_PROFILE PROPERTY STRINGS
+    debug fast-sim coverage)
+
+set(LOGIC_VERILATOR_CACHE_DIR "${CMAKE_BINARY_DIR}/verilator/cache" CACHE PATH
+    "Verilated model libraries cache directory, empty disables cache")
+
+find_program(CCACHE_EXECUTABLE ccache)
+mark_as_advanced(CCACHE_EXECUTABLE)
+
 if (VERILATOR_FOUND)
     file(MAKE_DIRECTORY "${CMAKE_BINARY_DIR}/verilator/unit_tests")
     file(MAKE_DIRECTORY "${CMAKE_BINARY_DIR}/verilator/coverage/run")
@@ -291,44 +303,375 @@ function(add_hdl_verilator)
         file(MAKE_DIRECTORY "${verilator_library_dir}")
 
         set(compile_flags "")
-        list(APPEND compile_flags --sc)
-        list(APPEND compile_flags --trace)
-        list(APPEND compile_flags --coverage)
+
+        if (NOT DEFINED ARG_OUTPUT)
+            set(ARG_OUTPUT sc)
+        endif()
+
+        if (ARG_OUTPUT MATCHES "^[Ss][Cc]$")
+            list(APPEND compile_flags --sc)
+        elseif (ARG_OUTPUT MATCHES "^[Cc][Cc]$")
+            list(APPEND compile_flags --cc)
+        else()
+            message(FATAL_ERROR "Unknown Verilator output ${ARG_OUTPUT} "
+                "for ${ARG_TARGET}, use sc or cc")
+        endif()
+
+        if (NOT DEFINED ARG_TRACE_FORMAT)
+            set(ARG_TRACE_FORMAT vcd)
+        endif()
+
+        set(trace_fst FALSE)
+
+        if (ARG_TRACE_FORMAT MATCHES "^[Ff][Ss][Tt]$")
+            if (VERILATOR_FST_FOUND)
+                set(trace_fst TRUE)
+            else()
+                message(WARNING "Verilator FST tracing is not available, "
+                    "using VCD for ${ARG_TARGET}")
+            endif()
+        endif()
+
+        if (trace_fst)
+            list(APPEND compile_flags --trace-fst)
+        else()
+            list(APPEND compile_flags --trace)
+        endif()
+
+        if (VERILATOR_THREADS_FOUND)
+            if (NOT ARG_THREADS)
+                set(ARG_THREADS 1)
+            endif()
+
+            list(APPEND compile_flags --threads ${ARG_THREADS})
+
+            if (ARG_THREADS_DPI)
+                list(APPEND compile_flags --threads-dpi ${ARG_THREADS_DPI})
+            endif()
+        elseif (ARG_THREADS GREATER 1 OR ARG_THREADS_DPI)
+            message(WARNING "Verilator runtime is not multithreaded, "
+                "using single thread for ${ARG_TARGET}")
+        endif()
+
+        if (DEFINED ARG_TRACE_THREADS)
+            set(trace_threads ${ARG_TRACE_THREADS})
+        elseif (trace_fst AND CMAKE_USE_PTHREADS_INIT)
+            set(trace_threads 1)
+        else()
+            set(trace_threads 0)
+        endif()
+
+        if (trace_threads GREATER 0)
+            if (VERILATOR_VERSION VERSION_LESS 4.200)
+                if (trace_fst AND CMAKE_USE_PTHREADS_INIT AND
+                        NOT VERILATOR_VERSION VERSION_LESS 4.000)
+                    list(APPEND compile_flags --trace-fst-thread)
+                elseif (DEFINED ARG_TRACE_THREADS)
+                    message(WARNING "Verilator ${VERILATOR_VERSION} "
+                        "supports trace threads only for FST tracing, "
+                        "tracing in model thread for ${ARG_TARGET}")
+                endif()
+            elseif (VERILATOR_THREADS_FOUND)
+                list(APPEND compile_flags --trace-threads ${trace_threads})
+            elseif (DEFINED ARG_TRACE_THREADS)
+                message(WARNING "Verilator runtime is not multithreaded, "
+                    "tracing in model thread for ${ARG_TARGET}")
+            endif()
+        endif()
+
+        if (NOT DEFINED ARG_PROFILE)
+            set(ARG_PROFILE ${LOGIC_VERILATOR_PROFILE})
+        endif()
+
+        set(make_flags "")
+        set(flags -std=c++11)
+
+        if (ARG_PROFILE MATCHES "^debug$")
+            list(APPEND compile_flags -O0)
+            list(APPEND compile_flags --x-assign unique)
+            list(APPEND compile_flags --x-initial unique)
+            list(APPEND flags -g)
+            list(APPEND make_flags OPT_FAST=-O0 OPT_SLOW=-O0)
+        elseif (ARG_PROFILE MATCHES "^fast-sim$")
+            list(APPEND compile_flags -O3)
+            list(APPEND compile_flags --x-assign fast)
+            list(APPEND compile_flags --x-initial fast)
+            list(APPEND compile_flags --output-split 20000)
+            list(APPEND compile_flags --output-split-cfuncs 20000)
+            list(APPEND flags -march=native)
+            list(APPEND make_flags OPT_FAST=-O3 OPT_SLOW=-O1)
+        elseif (ARG_PROFILE MATCHES "^coverage$")
+            list(APPEND compile_flags --coverage)
+            list(APPEND compile_flags -O2)
+            list(APPEND flags -fdata-sections -ffunction-sections)
+            list(APPEND make_flags OPT_FAST=-O2 OPT_SLOW=-O2)
+        else()
+            message(FATAL_ERROR "Unknown Verilator profile ${ARG_PROFILE} "
+                "for ${ARG_TARGET}, use debug, fast-sim or coverage")
+        endif()
+
+        if (ARG_SAVABLE)
+            list(APPEND compile_flags --savable)
+        endif()
+
         list(APPEND compile_flags --prefix ${ARG_TARGET})
-        list(APPEND compile_flags -O2)
         list(APPEND compile_flags -Mdir .)
 
-        if (CMAKE_CXX_COMPILER_ID MATCHES GNU OR
-                CMAKE_CXX_COMPILER_ID MATCHES Clang)
-            set(flags -std=c++11 -O2 -fdata-sections -ffunction-sections)
-            list(APPEND compile_flags -CFLAGS '${flags}')
+        if (NOT CMAKE_CXX_COMPILER_ID MATCHES GNU AND
+                NOT CMAKE_CXX_COMPILER_ID MATCHES Clang)
+            set(flags "")
+            set(make_flags "")
+        endif()
+
+        if (CCACHE_EXECUTABLE)
+            list(APPEND make_flags OBJCACHE=${CCACHE_EXECUTABLE})
+        endif()
+
+        if (ARG_PGO AND NOT CMAKE_CXX_COMPILER_ID MATCHES GNU)
+            message(WARNING "PGO is supported only with GCC, "
+                "building ${ARG_TARGET} without PGO")
+            set(ARG_PGO FALSE)
+        endif()
+
+        if (ARG_PGO AND NOT ARG_PGO_SOURCES)
+            message(FATAL_ERROR "PGO for ${ARG_TARGET} requires PGO_SOURCES")
         endif()
 
         set(verilator_library
             "${verilator_library_dir}/${ARG_TARGET}__ALL.a")
 
-        add_custom_command(
-            OUTPUT
-                "${verilator_library}"
-            COMMAND
-                ${VERILATOR_EXECUTABLE}
-            ARGS
-                ${compile_flags}
-                ${verilator_flags}
-                "${verilator_main}"
-            COMMAND
-                make
-            ARGS
-                -f ${ARG_TARGET}.mk
-            DEPENDS
+        if (ARG_PGO)
+            set(verilator_pgo_dir "${verilator_library_dir}/pgo")
+            set(verilator_pgo_library
+                "${verilator_pgo_dir}/${ARG_TARGET}__ALL.a")
+            set(verilator_pgo_profile "${verilator_pgo_dir}/profile.stamp")
+
+            file(MAKE_DIRECTORY "${verilator_pgo_dir}")
+
+            set(pgo_generate_flags "")
+            set(pgo_use_flags "")
+
+            if (NOT VERILATOR_VERSION VERSION_LESS 5.000)
+                list(APPEND pgo_generate_flags --prof-pgo)
+                list(APPEND pgo_use_flags "${verilator_pgo_dir}/profile.vlt")
+            endif()
+
+            set(generate_flags ${flags} -fprofile-generate)
+
+            if (VERILATOR_THREADS_FOUND)
+                list(APPEND generate_flags -fprofile-update=atomic)
+            endif()
+
+            set(use_flags ${flags} -fprofile-use -fprofile-correction
+                -Wno-missing-profile -Wno-coverage-mismatch)
+
+            add_custom_command(
+                OUTPUT
+                    "${verilator_pgo_library}"
+                COMMAND
+                    ${VERILATOR_EXECUTABLE}
+                ARGS
+                    ${compile_flags}
+                    ${pgo_generate_flags}
+                    -CFLAGS '${generate_flags}'
+                    ${verilator_flags}
+                    "${verilator_main}"
+                COMMAND
+                    make
+                ARGS
+                    -B
+                    -f ${ARG_TARGET}.mk
+                    ${make_flags}
+                COMMAND
+                    ${CMAKE_COMMAND}
+                ARGS
+                    -E copy "${verilator_library}" "${verilator_pgo_library}"
+                DEPENDS
+                    ${verilator_sources}
+                    ${verilator_includes}
+                    ${verilator_configuration_file}
+                WORKING_DIRECTORY
+                    ${verilator_library_dir}
+                COMMENT
+                    "Verilator compiling instrumented ${ARG_TARGET}"
+            )
+
+            add_custom_target(verilator-pgo-generate-${ARG_TARGET} DEPENDS
+                "${verilator_pgo_library}")
+
+            if (verilator_depends)
+                add_dependencies(verilator-pgo-generate-${ARG_TARGET}
+                    ${verilator_depends})
+            endif()
+
+            add_library(systemc-module-${ARG_TARGET}-pgo STATIC IMPORTED)
+
+            add_dependencies(systemc-module-${ARG_TARGET}-pgo
+                verilator-pgo-generate-${ARG_TARGET})
+
+            set_target_properties(systemc-module-${ARG_TARGET}-pgo PROPERTIES
+                IMPORTED_LOCATION "${verilator_pgo_library}"
+                INTERFACE_LINK_LIBRARIES
+                    "systemc;verilated;${CMAKE_THREAD_LIBS_INIT}"
+                INTERFACE_INCLUDE_DIRECTORIES "${verilator_library_dir}"
+                INTERFACE_SYSTEM_INCLUDE_DIRECTORIES
+                    "${verilator_library_dir}"
+            )
+
+            add_executable(${ARG_TARGET}_pgo ${ARG_PGO_SOURCES})
+
+            set_target_properties(${ARG_TARGET}_pgo PROPERTIES
+                RUNTIME_OUTPUT_DIRECTORY "${verilator_pgo_dir}"
+            )
+
+            logic_target_compile_options(${ARG_TARGET}_pgo)
+
+            logic_target_link_libraries(${ARG_TARGET}_pgo
+                logic
+                systemc-module-${ARG_TARGET}-pgo
+                -fprofile-generate
+            )
+
+            add_custom_command(
+                OUTPUT
+                    "${verilator_pgo_profile}"
+                COMMAND
+                    ${ARG_TARGET}_pgo
+                ARGS
+                    ${ARG_PGO_ARGS}
+                COMMAND
+                    ${CMAKE_COMMAND}
+                ARGS
+                    -E touch "${verilator_pgo_profile}"
+                DEPENDS
+                    ${ARG_TARGET}_pgo
+                WORKING_DIRECTORY
+                    "${verilator_pgo_dir}"
+                COMMENT
+                    "Training ${ARG_TARGET} for PGO"
+            )
+
+            add_custom_command(
+                OUTPUT
+                    "${verilator_library}"
+                COMMAND
+                    ${VERILATOR_EXECUTABLE}
+                ARGS
+                    ${compile_flags}
+                    -CFLAGS '${use_flags}'
+                    ${verilator_flags}
+                    ${pgo_use_flags}
+                    "${verilator_main}"
+                COMMAND
+                    make
+                ARGS
+                    -B
+                    -f ${ARG_TARGET}.mk
+                    ${make_flags}
+                DEPENDS
+                    "${verilator_pgo_profile}"
+                WORKING_DIRECTORY
+                    ${verilator_library_dir}
+                COMMENT
+                    "Verilator compiling ${ARG_TARGET} with PGO"
+            )
+        elseif (LOGIC_VERILATOR_CACHE_DIR)
+            set(verilator_cache_config
+                "${verilator_library_dir}/${ARG_TARGET}.cache.cmake")
+
+            set(verilator_args ${compile_flags})
+
+            if (flags)
+                string(REPLACE ";" " " cflags "${flags}")
+                list(APPEND verilator_args -CFLAGS "${cflags}")
+            endif()
+
+            list(APPEND verilator_args ${verilator_flags} "${verilator_main}")
+
+            set(verilator_inputs
                 ${verilator_sources}
+                ${verilator_files}
                 ${verilator_includes}
-                ${verilaotr_configuration_file}
-            WORKING_DIRECTORY
-                ${verilator_library_dir}
-            COMMENT
-                "Verilator compiling ${ARG_TARGET}"
-        )
+                ${verilator_configuration_file}
+                ${verilator_main}
+            )
+
+            set(verilator_cache "")
+
+            macro(set_verilator_cache name value)
+                set(verilator_cache
+                    "${verilator_cache}set(${name} [==[${value}]==])\n")
+            endmacro()
+
+            set_verilator_cache(VERILATOR_EXECUTABLE "${VERILATOR_EXECUTABLE}")
+            set_verilator_cache(VERILATOR_VERSION "${VERILATOR_VERSION}")
+            set_verilator_cache(VERILATOR_ARGS "${verilator_args}")
+            set_verilator_cache(VERILATOR_INPUTS "${verilator_inputs}")
+            set_verilator_cache(MAKE_ARGS "${make_flags}")
+            set_verilator_cache(CXX_COMPILER "${CMAKE_CXX_COMPILER}")
+            set_verilator_cache(CXX_COMPILER_ID "${CMAKE_CXX_COMPILER_ID}")
+            set_verilator_cache(CXX_COMPILER_VERSION
+                "${CMAKE_CXX_COMPILER_VERSION}")
+            set_verilator_cache(CFLAGS "${flags}")
+            set_verilator_cache(PREFIX "${ARG_TARGET}")
+            set_verilator_cache(SOURCE_DIR "${CMAKE_SOURCE_DIR}")
+            set_verilator_cache(BINARY_DIR "${CMAKE_BINARY_DIR}")
+            set_verilator_cache(CACHE_DIR "${LOGIC_VERILATOR_CACHE_DIR}")
+            set_verilator_cache(WORKING_DIRECTORY "${verilator_library_dir}")
+
+            file(WRITE "${verilator_cache_config}.in" "${verilator_cache}")
+
+            configure_file("${verilator_cache_config}.in"
+                "${verilator_cache_config}" COPYONLY)
+
+            add_custom_command(
+                OUTPUT
+                    "${verilator_library}"
+                COMMAND
+                    ${CMAKE_COMMAND}
+                ARGS
+                    -DCONFIG=${verilator_cache_config}
+                    -P ${_HDL_CMAKE_ROOT_DIR}/VerilatorCache.cmake
+                DEPENDS
+                    ${verilator_sources}
+                    ${verilator_includes}
+                    ${verilator_configuration_file}
+                    ${verilator_cache_config}
+                    ${_HDL_CMAKE_ROOT_DIR}/VerilatorCache.cmake
+                WORKING_DIRECTORY
+                    ${verilator_library_dir}
+                COMMENT
+                    "Verilator compiling ${ARG_TARGET}"
+            )
+        else()
+            if (flags)
+                list(APPEND compile_flags -CFLAGS '${flags}')
+            endif()
+
+            add_custom_command(
+                OUTPUT
+                    "${verilator_library}"
+                COMMAND
+                    ${VERILATOR_EXECUTABLE}
+                ARGS
+                    ${compile_flags}
+                    ${verilator_flags}
+                    "${verilator_main}"
+                COMMAND
+                    make
+                ARGS
+                    -f ${ARG_TARGET}.mk
+                    ${make_flags}
+                DEPENDS
+                    ${verilator_sources}
+                    ${verilator_includes}
+                    ${verilator_configuration_file}
+                WORKING_DIRECTORY
+                    ${verilator_library_dir}
+                COMMENT
+                    "Verilator compiling ${ARG_TARGET}"
+            )
+        endif()
 
         add_custom_target(verilator-compile-${ARG_TARGET} DEPENDS
             "${verilator_library}")
@@ -357,6 +700,7 @@ function(add_hdl_verilator)
         set(systemc_module_libraries
             systemc
             verilated
+            ${CMAKE_THREAD_LIBS_INIT}
         )
 
         set_target_properties(systemc-module-${ARG_TARGET} PROPERTIES
@@ -364,5 +708,10 @@ function(add_hdl_verilator)
             INTERFACE_LINK_LIBRARIES "${systemc_module_libraries}"
             INTERFACE_INCLUDE_DIRECTORIES "${systemc_module_includes}"
             INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "${systemc_module_includes}")
+
+        if (ARG_SAVABLE)
+            set_target_properties(systemc-module-${ARG_TARGET} PROPERTIES
+                INTERFACE_COMPILE_DEFINITIONS LOGIC_VERILATOR_SAVABLE)
+        endif()
     endif()
 endfunction()
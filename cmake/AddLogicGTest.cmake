@@ -0,0 +1,106 @@
+# Copyright 2018 Tymoteusz Blazejczyk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+if (COMMAND add_logic_gtest)
+    return()
+endif()
+
+include(CMakeParseArguments)
+include(CheckCXXCompilerFlag)
+
+set(CMAKE_REQUIRED_LIBRARIES -fsanitize=thread)
+check_cxx_compiler_flag(-fsanitize=thread LOGIC_TSAN_FOUND)
+unset(CMAKE_REQUIRED_LIBRARIES)
+
+# Builds <name>_test GTest executable from SOURCES linked with
+# logic-gtest-main and registers it in CTest. Logic headers are included
+# without SYSTEM, so header-only code under test reports warnings:
+#
+#   add_logic_gtest(logic_ring
+#       SOURCES logic_ring_test.cpp
+#       TSAN
+#   )
+#
+# TSAN also builds <name>_tsan_test instrumented with ThreadSanitizer when
+# compiler supports it. TSAN_SOURCES are compiled only into it, so library
+# code exercised by the test is instrumented too. LIBRARIES are linked to
+# both executables. Executables run in <build>/unit_tests/<name>
+function(add_logic_gtest name)
+    set(options
+        TSAN
+    )
+
+    set(multi_value_arguments
+        SOURCES
+        TSAN_SOURCES
+        LIBRARIES
+    )
+
+    cmake_parse_arguments(ARG "${options}" "" "${multi_value_arguments}"
+        ${ARGN})
+
+    set(output_directory "${CMAKE_BINARY_DIR}/unit_tests/${name}")
+
+    set(targets ${name}_test)
+
+    if (ARG_TSAN AND LOGIC_TSAN_FOUND)
+        list(APPEND targets ${name}_tsan_test)
+    endif()
+
+    foreach (target ${targets})
+        if (target STREQUAL ${name}_tsan_test)
+            add_executable(${target} ${ARG_SOURCES} ${ARG_TSAN_SOURCES})
+            set(sanitize -fsanitize=thread)
+        else()
+            add_executable(${target} ${ARG_SOURCES})
+            set(sanitize "")
+        endif()
+
+        set_target_properties(${target} PROPERTIES
+            RUNTIME_OUTPUT_DIRECTORY "${output_directory}"
+        )
+
+        target_include_directories(${target} PRIVATE
+            ${LOGIC_INCLUDE_DIR}
+        )
+
+        if (sanitize)
+            logic_target_compile_options(${target} ${sanitize} -g)
+        else()
+            logic_target_compile_options(${target})
+        endif()
+
+        logic_target_link_libraries(${target}
+            ${sanitize}
+            ${ARG_LIBRARIES}
+            logic-gtest-main
+            ${CMAKE_THREAD_LIBS_INIT}
+        )
+
+        add_test(
+            NAME
+                ${target}
+            COMMAND
+                ${target}
+            WORKING_DIRECTORY
+                "${output_directory}"
+        )
+
+        if (sanitize)
+            set_tests_properties(${target} PROPERTIES
+                ENVIRONMENT "TSAN_OPTIONS=halt_on_error=1"
+            )
+        endif()
+    endforeach()
+endfunction()
@@ -0,0 +1,71 @@
+# Copyright 2018 Tymoteusz Blazejczyk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+# Merges +logic_bench summaries of benchmark tests into a single JSON file.
+# Called as a CTest entry with:
+#
+#   cmake -DDIRECTORY=<dir> -DTESTS=<test,...> -DOUTPUT=<file>
+#       [-DSOURCE_DIR=<dir>] -P BenchmarkSummary.cmake
+#
+# Summary of every test is read from <dir>/<test>.json. Tests that did not
+# run are skipped.
+
+if (NOT DIRECTORY OR NOT OUTPUT)
+    message(FATAL_ERROR "DIRECTORY and OUTPUT must be provided")
+endif()
+
+string(REPLACE "," ";" tests "${TESTS}")
+
+set(commit "")
+
+find_program(GIT_EXECUTABLE git)
+
+if (GIT_EXECUTABLE AND SOURCE_DIR)
+    execute_process(
+        COMMAND ${GIT_EXECUTABLE} rev-parse HEAD
+        WORKING_DIRECTORY "${SOURCE_DIR}"
+        OUTPUT_VARIABLE commit
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+        ERROR_QUIET
+    )
+endif()
+
+string(TIMESTAMP timestamp "%Y-%m-%dT%H:%M:%SZ" UTC)
+
+set(results "")
+set(count 0)
+
+foreach (test ${tests})
+    set(summary "${DIRECTORY}/${test}.json")
+
+    if (EXISTS "${summary}")
+        file(READ "${summary}" result)
+        string(STRIP "${result}" result)
+        string(REGEX REPLACE "^{" "" result "${result}")
+
+        if (results)
+            set(results "${results},\n")
+        endif()
+
+        set(results "${results}    {\"name\":\"${test}\",${result}")
+        math(EXPR count "${count} + 1")
+    endif()
+endforeach()
+
+file(WRITE "${OUTPUT}" "{\n  \"commit\": \"${commit}\",\n"
+    "  \"timestamp\": \"${timestamp}\",\n"
+    "  \"results\": [\n${results}\n  ]\n}\n")
+
+message(STATUS "Benchmark summary of ${count} tests written to ${OUTPUT}")
@@ -21,7 +21,13 @@
 # ::
 #
 #   VERILATOR_EXECUTABLE    - Verilator
+#   VERILATOR_VERSION       - Verilator version, for example 4.008
+#   VERILATOR_FST_FOUND     - true if Verilator FST tracing is available
+#   VERILATOR_THREADS_FOUND - true if Verilator runtime is multithreaded
 #   VERILATOR_FOUND         - true if Verilator found
+#
+# Multithreaded runtime is built only when LOGIC_VERILATOR_THREADS is enabled.
+# All models share the runtime and are then verilated with --threads.
 
 if (COMMAND _find_verilator)
     return()
@@ -30,6 +36,7 @@ endif()
 function(_find_verilator)
     find_package(PackageHandleStandardArgs REQUIRED)
     find_package(SystemC)
+    find_package(ZLIB)
 
     find_program(VERILATOR_EXECUTABLE verilator
         HINTS $ENV{VERILATOR_ROOT}
@@ -59,18 +66,102 @@ function(_find_verilator)
     find_package_handle_standard_args(Verilator REQUIRED_VARS
         VERILATOR_EXECUTABLE VERILATOR_COVERAGE_EXECUTABLE VERILATOR_INCLUDE_DIR)
 
+    if (VERILATOR_EXECUTABLE)
+        execute_process(COMMAND ${VERILATOR_EXECUTABLE} --version
+            OUTPUT_VARIABLE verilator_version
+            OUTPUT_STRIP_TRAILING_WHITESPACE
+            ERROR_QUIET
+        )
+
+        string(REGEX MATCH "[0-9]+\\.[0-9]+" VERILATOR_VERSION
+            "${verilator_version}")
+    endif()
+
+    set(verilator_fst_sources
+        ${VERILATOR_INCLUDE_DIR}/gtkwave/fstapi.c
+        ${VERILATOR_INCLUDE_DIR}/gtkwave/fastlz.c
+        ${VERILATOR_INCLUDE_DIR}/gtkwave/lz4.c
+    )
+
+    set(VERILATOR_FST_FOUND ${ZLIB_FOUND})
+
+    foreach (verilator_fst_source ${verilator_fst_sources}
+            ${VERILATOR_INCLUDE_DIR}/verilated_fst_c.cpp
+            ${VERILATOR_INCLUDE_DIR}/verilated_fst_sc.cpp)
+        if (NOT EXISTS ${verilator_fst_source})
+            set(VERILATOR_FST_FOUND FALSE)
+        endif()
+    endforeach()
+
+    if (VERILATOR_FST_FOUND)
+        add_library(verilated-fst OBJECT ${verilator_fst_sources})
+
+        set_target_properties(verilated-fst PROPERTIES
+            POSITION_INDEPENDENT_CODE ON
+        )
+
+        target_include_directories(verilated-fst SYSTEM PRIVATE
+            ${VERILATOR_INCLUDE_DIR}/gtkwave
+            ${ZLIB_INCLUDE_DIRS}
+        )
+
+        target_compile_options(verilated-fst PRIVATE -w)
+
+        if (CMAKE_USE_PTHREADS_INIT)
+            target_compile_definitions(verilated-fst PRIVATE
+                FST_WRITER_PARALLEL
+            )
+        endif()
+
+        set(verilator_fst_sources
+            ${VERILATOR_INCLUDE_DIR}/verilated_fst_c.cpp
+            ${VERILATOR_INCLUDE_DIR}/verilated_fst_sc.cpp
+            $<TARGET_OBJECTS:verilated-fst>
+        )
+
+        if (CMAKE_USE_PTHREADS_INIT)
+            set_source_files_properties(
+                ${VERILATOR_INCLUDE_DIR}/verilated_fst_c.cpp
+                PROPERTIES
+                    COMPILE_DEFINITIONS "VL_TRACE_THREADED"
+            )
+        endif()
+    else()
+        set(verilator_fst_sources "")
+    endif()
+
     if (WIN32)
         set(library_policy STATIC)
     else()
         set(library_policy SHARED)
     endif()
 
+    set(verilator_threads_sources "")
+    set(VERILATOR_THREADS_FOUND FALSE)
+
+    if (LOGIC_VERILATOR_THREADS AND CMAKE_USE_PTHREADS_INIT AND
+            NOT VERILATOR_VERSION VERSION_LESS 4.000 AND
+            EXISTS ${VERILATOR_INCLUDE_DIR}/verilated_threads.cpp)
+        set(VERILATOR_THREADS_FOUND TRUE)
+        set(verilator_threads_sources
+            ${VERILATOR_INCLUDE_DIR}/verilated_threads.cpp)
+    endif()
+
+    set(verilator_save_sources "")
+
+    if (EXISTS ${VERILATOR_INCLUDE_DIR}/verilated_save.cpp)
+        set(verilator_save_sources ${VERILATOR_INCLUDE_DIR}/verilated_save.cpp)
+    endif()
+
     add_library(verilated ${library_policy}
         ${VERILATOR_INCLUDE_DIR}/verilated.cpp
         ${VERILATOR_INCLUDE_DIR}/verilated_cov.cpp
         ${VERILATOR_INCLUDE_DIR}/verilated_dpi.cpp
         ${VERILATOR_INCLUDE_DIR}/verilated_vcd_c.cpp
         ${VERILATOR_INCLUDE_DIR}/verilated_vcd_sc.cpp
+        ${verilator_fst_sources}
+        ${verilator_threads_sources}
+        ${verilator_save_sources}
         ${CMAKE_CURRENT_LIST_DIR}/verilator_callbacks.cpp
     )
 
@@ -94,6 +185,18 @@ function(_find_verilator)
 
     target_link_libraries(verilated PRIVATE systemc)
 
+    if (VERILATOR_FST_FOUND)
+        target_link_libraries(verilated PRIVATE ${ZLIB_LIBRARIES})
+    endif()
+
+    if (VERILATOR_THREADS_FOUND)
+        target_compile_definitions(verilated PUBLIC VL_THREADED=1)
+    endif()
+
+    if (CMAKE_USE_PTHREADS_INIT)
+        target_link_libraries(verilated PUBLIC ${CMAKE_THREAD_LIBS_INIT})
+    endif()
+
     set_target_properties(verilated PROPERTIES
         ARCHIVE_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib
         LIBRARY_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib
@@ -138,6 +241,9 @@ function(_find_verilator)
     endif()
 
     set(VERILATOR_FOUND ${VERILATOR_FOUND} PARENT_SCOPE)
+    set(VERILATOR_VERSION ${VERILATOR_VERSION} PARENT_SCOPE)
+    set(VERILATOR_FST_FOUND ${VERILATOR_FST_FOUND} PARENT_SCOPE)
+    set(VERILATOR_THREADS_FOUND ${VERILATOR_THREADS_FOUND} PARENT_SCOPE)
     set(VERILATOR_EXECUTABLE "${VERILATOR_EXECUTABLE}" PARENT_SCOPE)
     set(VERILATOR_INCLUDE_DIR "${VERILATOR_INCLUDE_DIR}" PARENT_SCOPE)
     set(VERILATOR_COVERAGE_EXECUTABLE "${VERILATOR_COVERAGE_EXECUTABLE}"
@@ -0,0 +1,165 @@
+# Copyright 2018 Tymoteusz Blazejczyk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+# Content-addressed cache for Verilated model libraries
+#
+# Invoked at build time with -DCONFIG=<file>. The configuration file sets:
+#
+#   VERILATOR_EXECUTABLE    - Verilator
+#   VERILATOR_VERSION       - Verilator version
+#   VERILATOR_ARGS          - Verilator arguments
+#   VERILATOR_INPUTS        - HDL sources, configuration files and include
+#                             directories
+#   MAKE_ARGS               - arguments for the generated makefile
+#   CXX_COMPILER            - C++ compiler
+#   CXX_COMPILER_ID         - C++ compiler identification
+#   CXX_COMPILER_VERSION    - C++ compiler version
+#   CFLAGS                  - C++ compiler flags passed to Verilator
+#   PREFIX                  - Verilated model prefix
+#   SOURCE_DIR              - project source directory
+#   BINARY_DIR              - project build directory
+#   CACHE_DIR               - cache directory
+#   WORKING_DIRECTORY       - Verilated model library directory
+#
+# Cache key is a SHA256 hash of the Verilator version, the C++ compiler
+# identification, version and flags, all arguments and the contents of all
+# input files. Source and build directories are replaced with placeholders
+# in arguments, file names and generated files, so the same model hits the
+# cache from other checkouts and build trees. Host specific flags like
+# -march=native are resolved to the predefined macros of the compiler. On a
+# hit the model library and its headers are copied from the cache, otherwise
+# model is verilated, compiled and stored in the cache.
+
+include("${CONFIG}")
+
+macro(_verilator_cache_relative var)
+    string(REPLACE "${BINARY_DIR}" "<binary>" ${var} "${${var}}")
+    string(REPLACE "${SOURCE_DIR}" "<source>" ${var} "${${var}}")
+endmacro()
+
+set(arguments "${VERILATOR_ARGS}")
+_verilator_cache_relative(arguments)
+
+set(make_arguments "")
+
+foreach (argument ${MAKE_ARGS})
+    if (NOT argument MATCHES "^OBJCACHE=")
+        list(APPEND make_arguments "${argument}")
+    endif()
+endforeach()
+
+set(key "${VERILATOR_VERSION}\n${CXX_COMPILER_ID}\n${CXX_COMPILER_VERSION}\n")
+set(key "${key}${CFLAGS}\n${PREFIX}\n${arguments}\n${make_arguments}\n")
+
+if (CFLAGS MATCHES "=native")
+    execute_process(
+        COMMAND ${CXX_COMPILER} ${CFLAGS} -E -dM -x c++ -
+        INPUT_FILE /dev/null
+        OUTPUT_VARIABLE native
+        RESULT_VARIABLE result
+        ERROR_QUIET
+    )
+
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Cannot resolve native flags for ${PREFIX}")
+    endif()
+
+    set(key "${key}${native}\n")
+endif()
+
+foreach (input ${VERILATOR_INPUTS})
+    if (IS_DIRECTORY "${input}")
+        file(GLOB files "${input}/*")
+        list(SORT files)
+    else()
+        set(files "${input}")
+    endif()
+
+    foreach (file ${files})
+        if (NOT IS_DIRECTORY "${file}")
+            string(FIND "${file}" "${BINARY_DIR}/" position)
+
+            if (position EQUAL 0)
+                file(READ "${file}" content)
+                _verilator_cache_relative(content)
+                string(SHA256 hash "${content}")
+            else()
+                file(SHA256 "${file}" hash)
+            endif()
+
+            set(name "${file}")
+            _verilator_cache_relative(name)
+            set(key "${key}${name} ${hash}\n")
+        endif()
+    endforeach()
+endforeach()
+
+string(SHA256 key "${key}")
+
+set(entry "${CACHE_DIR}/${key}")
+set(library "${PREFIX}__ALL.a")
+
+if (EXISTS "${entry}/${library}")
+    message(STATUS "Verilator cache hit ${PREFIX} ${key}")
+
+    file(GLOB headers "${entry}/*.h")
+    file(COPY ${headers} "${entry}/${library}"
+        DESTINATION "${WORKING_DIRECTORY}")
+
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E touch "${WORKING_DIRECTORY}/${library}"
+    )
+
+    return()
+endif()
+
+message(STATUS "Verilator cache miss ${PREFIX} ${key}")
+
+execute_process(
+    COMMAND ${VERILATOR_EXECUTABLE} ${VERILATOR_ARGS}
+    WORKING_DIRECTORY "${WORKING_DIRECTORY}"
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Verilator failed for ${PREFIX}")
+endif()
+
+execute_process(
+    COMMAND make -f ${PREFIX}.mk ${MAKE_ARGS}
+    WORKING_DIRECTORY "${WORKING_DIRECTORY}"
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Compilation failed for ${PREFIX}")
+endif()
+
+string(RANDOM LENGTH 16 suffix)
+set(staging "${CACHE_DIR}/.${key}.${suffix}")
+
+file(GLOB headers "${WORKING_DIRECTORY}/*.h")
+file(COPY ${headers} "${WORKING_DIRECTORY}/${library}"
+    DESTINATION "${staging}")
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E rename "${staging}" "${entry}"
+    RESULT_VARIABLE result
+    ERROR_QUIET
+)
+
+if (NOT result EQUAL 0)
+    file(REMOVE_RECURSE "${staging}")
+endif()
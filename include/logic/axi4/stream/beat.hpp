@@ -0,0 +1,49 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_BEAT_HPP
+#define LOGIC_AXI4_STREAM_BEAT_HPP
+
+#include "logic/bitstream.hpp"
+#include "tdata_byte.hpp"
+
+#include <systemc>
+
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+/* Class: logic::axi4::stream::beat
+ *
+ * Single AXI4-Stream transfer sampled by the monitor. Sent instead of whole
+ * packets when streaming compare mode is enabled.
+ */
+class beat {
+public:
+    bitstream tid{};
+    bitstream tdest{};
+    bitstream tuser{};
+    std::vector<tdata_byte> tdata{};
+    sc_core::sc_time timestamp{};
+    bool tlast{false};
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_BEAT_HPP */
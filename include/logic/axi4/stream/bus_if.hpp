@@ -40,6 +40,11 @@ public:
     using tdest_type = typename utils::bits<M_TDEST_WIDTH>::type;
     using tuser_type = typename utils::bits<M_TUSER_WIDTH>::type;
 
+    sc_core::sc_in<bool> aclk{"aclk"};
+    sc_core::sc_in<bool> areset_n{"areset_n"};
+    sc_core::sc_signal<bool> tvalid{"tvalid"};
+    sc_core::sc_signal<bool> tready{"tready"};
+    sc_core::sc_signal<bool> tlast{"tlast"};
     sc_core::sc_signal<tid_type> tid{"tid"};
     sc_core::sc_signal<tdata_type> tdata{"tdata"};
     sc_core::sc_signal<tstrb_type> tstrb{"tstrb"};
@@ -60,9 +65,12 @@ public:
     bus_if& operator=(const bus_if&) = delete;
 
     void trace(sc_core::sc_trace_file* trace_file) const override {
-        bus_if_base::trace(trace_file);
-
         if (trace_file != nullptr) {
+            sc_core::sc_trace(trace_file, aclk, aclk.name());
+            sc_core::sc_trace(trace_file, areset_n, areset_n.name());
+            sc_core::sc_trace(trace_file, tvalid, tvalid.name());
+            sc_core::sc_trace(trace_file, tready, tready.name());
+            sc_core::sc_trace(trace_file, tlast, tlast.name());
             sc_core::sc_trace(trace_file, tid, tid.name());
             sc_core::sc_trace(trace_file, tdata, tdata.name());
             sc_core::sc_trace(trace_file, tstrb, tstrb.name());
@@ -71,6 +79,62 @@ public:
         }
     }
 
+    void aclk_posedge() override {
+        sc_core::wait(aclk.posedge_event());
+    }
+
+    std::size_t aclk_posedge(std::size_t cycles) override {
+        auto clock = dynamic_cast<const sc_core::sc_clock*>(
+                aclk.get_interface());
+
+        if (nullptr == clock) {
+            return bus_if_base::aclk_posedge(cycles);
+        }
+
+        auto posedge = clock->start_time();
+
+        if (!clock->posedge_first()) {
+            posedge = posedge + clock->period() * (1.0 - clock->duty_cycle());
+        }
+
+        if (m_tready_driven) {
+            return aclk_skip(cycles, clock->period(), posedge,
+                    sc_core::sc_event_or_list{areset_n.negedge_event()});
+        }
+
+        return aclk_skip(cycles, clock->period(), posedge,
+                areset_n.negedge_event() | tready.value_changed_event());
+    }
+
+    bool get_areset_n() const override {
+        return areset_n.read();
+    }
+
+    void set_tvalid(bool value) override {
+        tvalid.write(value);
+    }
+
+    bool get_tvalid() const override {
+        return tvalid.read();
+    }
+
+    void set_tready(bool value) override {
+        m_tready_driven = true;
+        tready.write(value);
+    }
+
+    bool get_tready() const override {
+        return tready.read();
+    }
+
+    void set_tlast(bool value) override {
+        tlast.write(value);
+    }
+
+    bool get_tlast() const override {
+        return tlast.read();
+    }
+
     std::size_t size() const noexcept override {
         return M_TDATA_BYTES;
     }
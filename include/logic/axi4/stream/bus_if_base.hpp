@@ -27,33 +27,43 @@ namespace logic {
 namespace axi4 {
 namespace stream {
 
+/* Class: logic::axi4::stream::bus_if_base
+ *
+ * Abstract AXI4-Stream virtual interface used by drivers and monitor.
+ * Implemented with SystemC signals by <logic::axi4::stream::bus_if> and with
+ * direct Verilated model port access by
+ * <logic::axi4::stream::bus_if_verilated>.
+ */
 class bus_if_base : public sc_core::sc_module {
 public:
-    sc_core::sc_in<bool> aclk;
-    sc_core::sc_in<bool> areset_n;
-    sc_core::sc_signal<bool> tvalid;
-    sc_core::sc_signal<bool> tready;
-    sc_core::sc_signal<bool> tlast;
-
     explicit bus_if_base(const sc_core::sc_module_name& module_name);
 
-    void aclk_posedge();
+    virtual void aclk_posedge() = 0;
 
-    bool get_areset_n() const;
+    /* Function: aclk_posedge
+     *
+     * Waits for up to cycles rising edges of aclk in a single call. Returns
+     * earlier, on the first rising edge that samples asserted areset_n or
+     * changed tready, so all rising edges before it sampled the same values.
+     * Once tready is driven through this interface by <set_tready>, like by
+     * Tx driver, its changes are own writes and only areset_n ends waiting.
+     * Returns number of rising edges waited for.
+     */
+    virtual std::size_t aclk_posedge(std::size_t cycles);
 
-    void set_tvalid(bool value);
+    virtual bool get_areset_n() const = 0;
 
-    bool get_tvalid() const;
+    virtual void set_tvalid(bool value) = 0;
 
-    void set_tready(bool value);
+    virtual bool get_tvalid() const = 0;
 
-    bool get_tready() const;
+    virtual void set_tready(bool value) = 0;
 
-    void set_tlast(bool value);
+    virtual bool get_tready() const = 0;
 
-    bool get_tlast() const;
+    virtual void set_tlast(bool value) = 0;
 
-    void trace(sc_core::sc_trace_file* trace_file) const override;
+    virtual bool get_tlast() const = 0;
 
     virtual std::size_t size() const noexcept = 0;
 
@@ -90,6 +100,12 @@ public:
     bus_if_base& operator=(const bus_if_base&) = delete;
 
     ~bus_if_base() override;
+protected:
+    std::size_t aclk_skip(std::size_t cycles, const sc_core::sc_time& period,
+            const sc_core::sc_time& posedge,
+            const sc_core::sc_event_or_list& stop);
+
+    bool m_tready_driven{false};
 };
 
 } /* namespace stream */
@@ -0,0 +1,368 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_BUS_IF_VERILATED_HPP
+#define LOGIC_AXI4_STREAM_BUS_IF_VERILATED_HPP
+
+#include "logic/bitstream.hpp"
+#include "logic/axi4/stream/bus_if_base.hpp"
+
+#include <systemc>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+/* Define: LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND
+ *
+ * Binds <logic::axi4::stream::bus_if_verilated> to Verilated model ports
+ * named <prefix>_tvalid, <prefix>_tready and so on.
+ */
+#define LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND(bus, direction, model, prefix) \
+    (bus).bind(direction, \
+        (model).prefix##_tvalid, \
+        (model).prefix##_tready, \
+        (model).prefix##_tlast, \
+        (model).prefix##_tkeep, \
+        (model).prefix##_tstrb, \
+        (model).prefix##_tdata, \
+        (model).prefix##_tid, \
+        (model).prefix##_tdest, \
+        (model).prefix##_tuser)
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+namespace verilated {
+    template<typename T>
+    using enable_narrow = typename std::enable_if<
+        std::is_integral<T>::value, int>::type;
+
+    template<typename T>
+    using enable_wide = typename std::enable_if<
+        !std::is_integral<T>::value, int>::type;
+
+    template<typename T, enable_narrow<T> = 0>
+    static inline bool get_bool(const T& port, std::size_t offset) noexcept {
+        return 0 != ((port >> offset) & 1u);
+    }
+
+    template<typename T, enable_narrow<T> = 0>
+    static inline void set_bool(T& port, std::size_t offset,
+            bool value) noexcept {
+        port = T((port & ~(T(1) << offset)) | (T(value) << offset));
+    }
+
+    template<typename T, enable_narrow<T> = 0>
+    static inline std::uint8_t get_uint8(const T& port,
+            std::size_t offset) noexcept {
+        return std::uint8_t(port >> offset);
+    }
+
+    template<typename T, enable_narrow<T> = 0>
+    static inline void set_uint8(T& port, std::size_t offset,
+            std::uint8_t value) noexcept {
+        port = T((port & ~(T(0xFF) << offset)) | (T(value) << offset));
+    }
+
+    template<typename T, enable_wide<T> = 0>
+    static inline bool get_bool(const T& port, std::size_t offset) noexcept {
+        return 0 != ((port[offset / 32u] >> (offset % 32u)) & 1u);
+    }
+
+    template<typename T, enable_wide<T> = 0>
+    static inline void set_bool(T& port, std::size_t offset,
+            bool value) noexcept {
+        set_bool(port[offset / 32u], offset % 32u, value);
+    }
+
+    template<typename T, enable_wide<T> = 0>
+    static inline std::uint8_t get_uint8(const T& port,
+            std::size_t offset) noexcept {
+        return get_uint8(port[offset / 32u], offset % 32u);
+    }
+
+    template<typename T, enable_wide<T> = 0>
+    static inline void set_uint8(T& port, std::size_t offset,
+            std::uint8_t value) noexcept {
+        set_uint8(port[offset / 32u], offset % 32u, value);
+    }
+} /* namespace verilated */
+
+/* Class: logic::axi4::stream::bus_if_verilated
+ *
+ * AXI4-Stream virtual interface that reads and writes ports of Verilated C++
+ * model (verilator --cc) directly, without SystemC signals. Values written
+ * by drivers are applied to model ports by <logic::verilated_loop> after
+ * clock edge and values read by drivers and monitor are sampled before
+ * clock edge, the same way as with SystemC signals.
+ */
+template<std::size_t M_TDATA_BYTES = 1,
+    std::size_t M_TID_WIDTH = 1,
+    std::size_t M_TDEST_WIDTH = 1,
+    std::size_t M_TUSER_WIDTH = 1>
+class bus_if_verilated : public bus_if_base {
+public:
+    enum direction_t {
+        RX,
+        TX
+    };
+
+    explicit bus_if_verilated(const sc_core::sc_module_name& module_name) :
+        bus_if_base{module_name}
+    { }
+
+    template<typename Valid, typename Ready, typename Last, typename Keep,
+        typename Strb, typename Data, typename Id, typename Dest,
+        typename User>
+    void bind(direction_t direction, Valid& tvalid, Ready& tready,
+            Last& tlast, Keep& tkeep, Strb& tstrb, Data& tdata, Id& tid,
+            Dest& tdest, User& tuser) {
+        if (RX == direction) {
+            m_apply = [this, &tvalid, &tlast, &tkeep, &tstrb, &tdata, &tid,
+                    &tdest, &tuser] () {
+                const bool tready_value = m_current.tready;
+                m_current = m_next;
+                m_current.tready = tready_value;
+
+                tvalid = Valid(m_current.tvalid);
+                tlast = Last(m_current.tlast);
+
+                for (std::size_t i = 0u; i < M_TDATA_BYTES; ++i) {
+                    verilated::set_uint8(tdata, 8u * i, m_current.tdata[i]);
+                    verilated::set_bool(tkeep, i, m_current.tkeep[i]);
+                    verilated::set_bool(tstrb, i, m_current.tstrb[i]);
+                }
+
+                write(tid, m_current.tid);
+                write(tdest, m_current.tdest);
+                write(tuser, m_current.tuser);
+            };
+
+            m_sample = [this, &tready] () {
+                m_current.tready = (0 != tready);
+            };
+        }
+        else {
+            m_apply = [this, &tready] () {
+                m_current.tready = m_next.tready;
+                tready = Ready(m_current.tready);
+            };
+
+            m_sample = [this, &tvalid, &tlast, &tkeep, &tstrb, &tdata, &tid,
+                    &tdest, &tuser] () {
+                m_current.tvalid = (0 != tvalid);
+                m_current.tlast = (0 != tlast);
+
+                for (std::size_t i = 0u; i < M_TDATA_BYTES; ++i) {
+                    m_current.tdata[i] = verilated::get_uint8(tdata, 8u * i);
+                    m_current.tkeep[i] = verilated::get_bool(tkeep, i);
+                    m_current.tstrb[i] = verilated::get_bool(tstrb, i);
+                }
+
+                read(tid, m_current.tid);
+                read(tdest, m_current.tdest);
+                read(tuser, m_current.tuser);
+            };
+        }
+    }
+
+    void connect(const sc_core::sc_event& posedge, const bool& areset_n,
+            const sc_core::sc_time& period) {
+        m_posedge = &posedge;
+        m_areset_n = &areset_n;
+        m_period = period;
+    }
+
+    void apply() {
+        if (m_apply) {
+            m_apply();
+        }
+    }
+
+    void sample() {
+        if (m_sample) {
+            m_sample();
+        }
+
+        const bool reset = m_last_areset_n && !*m_areset_n;
+
+        if (reset || (!m_tready_driven &&
+                    (m_last_tready != m_current.tready))) {
+            m_stop.notify(sc_core::SC_ZERO_TIME);
+        }
+
+        m_last_areset_n = *m_areset_n;
+        m_last_tready = m_current.tready;
+    }
+
+    void aclk_posedge() override {
+        sc_core::wait(*m_posedge);
+    }
+
+    std::size_t aclk_posedge(std::size_t cycles) override {
+        return aclk_skip(cycles, m_period, sc_core::SC_ZERO_TIME,
+                sc_core::sc_event_or_list{m_stop});
+    }
+
+    bool get_areset_n() const override {
+        return *m_areset_n;
+    }
+
+    void set_tvalid(bool value) override {
+        m_next.tvalid = value;
+    }
+
+    bool get_tvalid() const override {
+        return m_current.tvalid;
+    }
+
+    void set_tready(bool value) override {
+        m_tready_driven = true;
+        m_next.tready = value;
+    }
+
+    bool get_tready() const override {
+        return m_current.tready;
+    }
+
+    void set_tlast(bool value) override {
+        m_next.tlast = value;
+    }
+
+    bool get_tlast() const override {
+        return m_current.tlast;
+    }
+
+    std::size_t size() const noexcept override {
+        return M_TDATA_BYTES;
+    }
+
+    std::uint8_t get_tdata(std::size_t offset) const override {
+        return m_current.tdata[offset];
+    }
+
+    void set_tdata(std::size_t offset, std::uint8_t value) override {
+        m_next.tdata[offset] = value;
+    }
+
+    bool get_tkeep(std::size_t offset) const override {
+        return m_current.tkeep[offset];
+    }
+
+    void set_tkeep(std::size_t offset, bool value) override {
+        m_next.tkeep[offset] = value;
+    }
+
+    bool get_tstrb(std::size_t offset) const override {
+        return m_current.tstrb[offset];
+    }
+
+    void set_tstrb(std::size_t offset, bool value) override {
+        m_next.tstrb[offset] = value;
+    }
+
+    bitstream get_tid() const override {
+        return m_current.tid;
+    }
+
+    void set_tid(const bitstream& bits) override {
+        assign(m_next.tid, bits);
+    }
+
+    bitstream get_tdest() const override {
+        return m_current.tdest;
+    }
+
+    void set_tdest(const bitstream& bits) override {
+        assign(m_next.tdest, bits);
+    }
+
+    bitstream get_tuser() const override {
+        return m_current.tuser;
+    }
+
+    void set_tuser(const bitstream& bits) override {
+        assign(m_next.tuser, bits);
+    }
+
+    bus_if_verilated(bus_if_verilated&&) = delete;
+
+    bus_if_verilated(const bus_if_verilated&) = delete;
+
+    bus_if_verilated& operator=(bus_if_verilated&&) = delete;
+
+    bus_if_verilated& operator=(const bus_if_verilated&) = delete;
+
+    ~bus_if_verilated() override;
+private:
+    struct state {
+        bool tvalid{false};
+        bool tready{false};
+        bool tlast{false};
+        std::array<std::uint8_t, M_TDATA_BYTES> tdata{{}};
+        std::bitset<M_TDATA_BYTES> tkeep{};
+        std::bitset<M_TDATA_BYTES> tstrb{};
+        bitstream tid{M_TID_WIDTH};
+        bitstream tdest{M_TDEST_WIDTH};
+        bitstream tuser{M_TUSER_WIDTH};
+    };
+
+    static void assign(bitstream& lhs, const bitstream& rhs) {
+        for (std::size_t i = 0u; i < lhs.size(); ++i) {
+            lhs[i] = (i < rhs.size()) && bool(rhs[i]);
+        }
+    }
+
+    template<typename T>
+    static void write(T& port, const bitstream& bits) {
+        for (std::size_t i = 0u; i < bits.size(); ++i) {
+            verilated::set_bool(port, i, bool(bits[i]));
+        }
+    }
+
+    template<typename T>
+    static void read(const T& port, bitstream& bits) {
+        for (std::size_t i = 0u; i < bits.size(); ++i) {
+            bits[i] = verilated::get_bool(port, i);
+        }
+    }
+
+    state m_current{};
+    state m_next{};
+    const sc_core::sc_event* m_posedge{nullptr};
+    const bool* m_areset_n{nullptr};
+    sc_core::sc_time m_period{sc_core::SC_ZERO_TIME};
+    sc_core::sc_event m_stop{};
+    bool m_last_areset_n{false};
+    bool m_last_tready{false};
+    std::function<void()> m_apply{};
+    std::function<void()> m_sample{};
+};
+
+template<std::size_t M_TDATA_BYTES, std::size_t M_TID_WIDTH,
+    std::size_t M_TDEST_WIDTH, std::size_t M_TUSER_WIDTH>
+bus_if_verilated<M_TDATA_BYTES, M_TID_WIDTH, M_TDEST_WIDTH,
+    M_TUSER_WIDTH>::~bus_if_verilated() = default;
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_BUS_IF_VERILATED_HPP */
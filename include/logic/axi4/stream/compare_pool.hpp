@@ -0,0 +1,117 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_COMPARE_POOL_HPP
+#define LOGIC_AXI4_STREAM_COMPARE_POOL_HPP
+
+#include "packet.hpp"
+#include "packet_diff.hpp"
+
+#include "logic/spsc_ring.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+/* Class: logic::axi4::stream::compare_pool
+ *
+ * Compares packet pairs with <logic::axi4::stream::packet_diff> on worker
+ * threads, so checking overlaps with simulation. Pairs are assigned to
+ * workers round-robin, every worker has fixed number of job slots and two
+ * <logic::spsc_ring> queues with slot indices: jobs from the simulation
+ * thread and completed jobs back. Idle workers sleep with
+ * <logic::blocking_wait>. Verdicts are collected by the simulation
+ * thread in submission order, reporting is the same as without the pool.
+ * <collect> handles at most limit verdicts, with wait set it sleeps on the
+ * done queue of the worker holding the oldest pending job.
+ *
+ * Packets are never copied by the pool. <acquire> returns next free job
+ * slot, or nullptr when all slots of the worker in turn are pending, it
+ * can be filled in place and handed over with <submit>. Overload taking
+ * packets swaps them with the slot and leaves them untouched when pool is
+ * full. Workers free payload of matching packets after comparing them, so
+ * simulation thread does not pay for it when moving next packets in. Only
+ * mismatching packets stay in the slot for reporting.
+ *
+ * All member functions must be called from the simulation thread.
+ */
+class compare_pool {
+public:
+    struct job {
+        packet expected{"rx"};
+        packet actual{"tx"};
+        std::string report{};
+        bool equal{true};
+    };
+
+    using callback = std::function<void(job&)>;
+
+    compare_pool(std::size_t workers, std::size_t depth,
+            const packet_diff& diff);
+
+    job* acquire() noexcept;
+
+    void submit();
+
+    bool submit(packet&& expected, packet&& actual);
+
+    std::size_t collect(bool wait, const callback& handler,
+            std::size_t limit = std::numeric_limits<std::size_t>::max());
+
+    std::size_t pending() const noexcept;
+
+    compare_pool(compare_pool&&) = delete;
+
+    compare_pool(const compare_pool&) = delete;
+
+    compare_pool& operator=(compare_pool&&) = delete;
+
+    compare_pool& operator=(const compare_pool&) = delete;
+
+    ~compare_pool();
+private:
+    struct worker {
+        explicit worker(std::size_t depth, const packet_diff& value);
+
+        std::vector<job> slots;
+        spsc_ring<std::size_t, blocking_wait> jobs;
+        spsc_ring<std::size_t, blocking_wait> done;
+        packet_diff diff;
+        std::size_t submitted{0};
+        std::size_t collected{0};
+        std::thread thread{};
+    };
+
+    void run(worker& value);
+
+    std::vector<std::unique_ptr<worker>> m_workers;
+    std::size_t m_depth;
+    std::size_t m_submitted;
+    std::size_t m_collected;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_COMPARE_POOL_HPP */
@@ -0,0 +1,125 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_COVERAGE_HPP
+#define LOGIC_AXI4_STREAM_COVERAGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+class bus_if_base;
+
+/* Class: logic::axi4::stream::coverage
+ *
+ * Functional coverage collector sampled by the monitor on every clock cycle.
+ * Bins are plain counters stored in flat arrays, one group per covered item:
+ *
+ *  - PACKET_LENGTH - number of kept bytes in packet, log2 bins
+ *  - BEAT_COUNT - number of transfers in packet, log2 bins
+ *  - LAST_TKEEP - number of kept bytes in last transfer, one bin per byte
+ *  - GAP - idle cycles between transfers of packet, log2 bins
+ *  - BACKPRESSURE - cycles with tvalid asserted and tready deasserted in
+ *    a row, log2 bins
+ *  - TID_TDEST - tid and tdest pair of packet, one bin per pair, only
+ *    PAIR_BITS lower bits of tid and tdest are used, tid in upper half of
+ *    bin index
+ *
+ * Log2 bin index is the bit width of value: 0, 1, 2-3, 4-7, 8-15, ...
+ *
+ * Coverage goal is defined with <require> as ranges of bins that must be
+ * hit at least given number of times. Goal is met when <covered> returns
+ * true.
+ */
+class coverage {
+public:
+    enum group_t {
+        PACKET_LENGTH,
+        BEAT_COUNT,
+        LAST_TKEEP,
+        GAP,
+        BACKPRESSURE,
+        TID_TDEST,
+        GROUPS
+    };
+
+    static constexpr std::size_t LOG2_BINS{33};
+
+    static constexpr std::size_t PAIR_BITS{4};
+
+    coverage();
+
+    void sample(const bus_if_base& vif);
+
+    void require(group_t group, std::size_t first, std::size_t last,
+            std::uint64_t at_least = 1);
+
+    bool covered() const noexcept;
+
+    double ratio() const noexcept;
+
+    std::uint64_t hits(group_t group, std::size_t index) const noexcept;
+
+    std::size_t bins(group_t group) const noexcept;
+
+    std::string report() const;
+
+    void clear() noexcept;
+
+    static std::size_t bin(std::uint64_t value) noexcept;
+
+    static const char* to_string(group_t group) noexcept;
+
+    coverage(coverage&&) = delete;
+
+    coverage(const coverage&) = delete;
+
+    coverage& operator=(coverage&&) = delete;
+
+    coverage& operator=(const coverage&) = delete;
+
+    ~coverage();
+private:
+    struct goal {
+        group_t group{PACKET_LENGTH};
+        std::size_t first{0};
+        std::size_t last{0};
+        std::uint64_t at_least{0};
+    };
+
+    void hit(group_t group, std::size_t index) noexcept;
+
+    void end_backpressure() noexcept;
+
+    std::array<std::vector<std::uint64_t>, GROUPS> m_bins{};
+    std::vector<goal> m_goals{};
+    std::uint64_t m_length{0};
+    std::uint64_t m_beats{0};
+    std::uint64_t m_gap{0};
+    std::uint64_t m_backpressure{0};
+    bool m_in_packet{false};
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_COVERAGE_HPP */
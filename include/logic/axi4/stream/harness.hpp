@@ -0,0 +1,159 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_HARNESS_HPP
+#define LOGIC_AXI4_STREAM_HARNESS_HPP
+
+#include "logic/trace.hpp"
+#include "logic/command_line.hpp"
+#include "logic/test_server.hpp"
+#include "logic/axi4/stream/bus_if.hpp"
+#include "logic/axi4/stream/reset_if.hpp"
+
+#include <uvm>
+#include <systemc>
+
+#include <cstddef>
+#include <string>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+/* Class: logic::axi4::stream::harness
+ *
+ * Generic UVM-SystemC test top for Verilated logic_axi4_stream_*_top
+ * modules with single Rx and Tx interface. Model ports are bound by naming
+ * convention: aclk, areset_n, rx_* and tx_* AXI4-Stream signals. Virtual
+ * interfaces are registered for rx_agent, tx_agent and reset_agent and
+ * monitor protocol checks are enabled.
+ *
+ * Use <main> as complete sc_main() body:
+ *
+ * (start code)
+ * int sc_main(int argc, char* argv[]) {
+ *     return logic::axi4::stream::harness<dut_top, 4>::main("dut_top",
+ *         argc, argv);
+ * }
+ * (end)
+ */
+template<typename Model,
+    std::size_t M_TDATA_BYTES = 1,
+    std::size_t M_TID_WIDTH = 1,
+    std::size_t M_TDEST_WIDTH = 1,
+    std::size_t M_TUSER_WIDTH = 1>
+class harness {
+public:
+    using bus_if_type = bus_if<M_TDATA_BYTES, M_TID_WIDTH, M_TDEST_WIDTH,
+          M_TUSER_WIDTH>;
+
+    sc_core::sc_clock aclk{"aclk"};
+    sc_core::sc_signal<bool> areset_n{"areset_n"};
+    bus_if_type rx{"rx"};
+    bus_if_type tx{"tx"};
+    reset_if reset{};
+    Model dut;
+
+    static int main(const char* name, int argc, char* argv[]) {
+        logic::command_line{argc, argv};
+
+        logic::test_server server{argc, argv};
+
+        harness top{name};
+
+        return server.run([&top] () {
+            return top.run();
+        });
+    }
+
+    explicit harness(const char* name) :
+        dut{name}
+    {
+        uvm::uvm_config_db<bus_if_base*>::set(nullptr, "*.rx_agent.*",
+                "vif", &rx);
+
+        uvm::uvm_config_db<bus_if_base*>::set(nullptr, "*.tx_agent.*",
+                "vif", &tx);
+
+        uvm::uvm_config_db<reset_if*>::set(nullptr, "*.reset_agent.*",
+                "vif", &reset);
+
+        uvm::uvm_config_db<bool>::set(nullptr, "*", "checks_enable", true);
+
+        reset.aclk(aclk);
+        reset.areset_n(areset_n);
+
+        rx.aclk(aclk);
+        rx.areset_n(areset_n);
+
+        tx.aclk(aclk);
+        tx.areset_n(areset_n);
+
+        dut.aclk(aclk);
+        dut.areset_n(areset_n);
+        dut.rx_tready(rx.tready);
+        dut.rx_tvalid(rx.tvalid);
+        dut.rx_tlast(rx.tlast);
+        dut.rx_tkeep(rx.tkeep);
+        dut.rx_tstrb(rx.tstrb);
+        dut.rx_tuser(rx.tuser);
+        dut.rx_tdata(rx.tdata);
+        dut.rx_tdest(rx.tdest);
+        dut.rx_tid(rx.tid);
+
+        dut.tx_tready(tx.tready);
+        dut.tx_tvalid(tx.tvalid);
+        dut.tx_tlast(tx.tlast);
+        dut.tx_tkeep(tx.tkeep);
+        dut.tx_tstrb(tx.tstrb);
+        dut.tx_tuser(tx.tuser);
+        dut.tx_tdata(tx.tdata);
+        dut.tx_tdest(tx.tdest);
+        dut.tx_tid(tx.tid);
+    }
+
+    bool run() {
+        bool test_passed{false};
+        std::string trace_filename{dut.name()};
+
+        uvm::uvm_config_db<std::string>::get(nullptr, "*", "trace_filename",
+                trace_filename);
+
+        logic::trace<Model> trace{dut, trace_filename};
+
+        uvm::run_test();
+
+        uvm::uvm_config_db<bool>::get(nullptr, "*", "test_passed",
+                test_passed);
+
+        return test_passed;
+    }
+
+    harness(harness&&) = delete;
+
+    harness(const harness&) = delete;
+
+    harness& operator=(harness&&) = delete;
+
+    harness& operator=(const harness&) = delete;
+
+    ~harness() = default;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_HARNESS_HPP */
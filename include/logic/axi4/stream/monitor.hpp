@@ -18,11 +18,15 @@
 
 #include <uvm>
 
+#include <memory>
+
 namespace logic {
 namespace axi4 {
 namespace stream {
 
+class beat;
 class packet;
+class coverage;
 class bus_if_base;
 
 class monitor : public uvm::uvm_monitor {
@@ -44,14 +48,20 @@ public:
     ~monitor() override;
 
     uvm::uvm_analysis_port<packet> analysis_port;
+    uvm::uvm_analysis_port<beat> beat_analysis_port;
 protected:
     void build_phase(uvm::uvm_phase& phase) override;
 
     [[noreturn]] void run_phase(uvm::uvm_phase& phase) override;
 
+    void report_phase(uvm::uvm_phase& phase) override;
+
     bus_if_base* m_vif;
+    coverage* m_coverage;
+    std::unique_ptr<coverage> m_coverage_owned;
     bool m_checks_enable;
     bool m_coverage_enable;
+    bool m_streaming;
 };
 
 } /* namespace stream */
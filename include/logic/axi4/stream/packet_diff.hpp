@@ -0,0 +1,107 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_PACKET_DIFF_HPP
+#define LOGIC_AXI4_STREAM_PACKET_DIFF_HPP
+
+#include "tdata_byte.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+class packet;
+
+/* Class: logic::axi4::stream::packet_diff
+ *
+ * Compares two packets and collects a bounded, structured list of
+ * differences: tid, tdest, tuser transfers and the first mismatching tdata
+ * bytes together with a context window around the first difference.
+ * Payload is searched eight bytes at a time.
+ */
+class packet_diff {
+public:
+    struct difference {
+        std::size_t offset;
+        tdata_byte expected;
+        tdata_byte actual;
+    };
+
+    explicit packet_diff(std::size_t max_differences = 8,
+            std::size_t context = 16);
+
+    bool compare(const packet& expected, const packet& actual);
+
+    bool equal() const noexcept;
+
+    const std::vector<difference>& differences() const noexcept;
+
+    std::size_t tdata_mismatches() const noexcept;
+
+    std::size_t tuser_mismatches() const noexcept;
+
+    std::string report() const;
+
+    static std::size_t mismatch(const std::uint8_t* lhs,
+            const std::uint8_t* rhs, std::size_t size) noexcept;
+
+    packet_diff(packet_diff&&) = default;
+
+    packet_diff(const packet_diff&) = default;
+
+    packet_diff& operator=(packet_diff&&) = default;
+
+    packet_diff& operator=(const packet_diff&) = default;
+
+    ~packet_diff();
+private:
+    void compare_tdata(const packet& expected, const packet& actual);
+
+    void compare_tuser(const packet& expected, const packet& actual);
+
+    void dump(std::string& output, const char* name,
+            const std::vector<std::uint8_t>& data,
+            const std::vector<std::uint8_t>& types) const;
+
+    std::size_t m_max_differences;
+    std::size_t m_context;
+    std::size_t m_bus_size;
+    std::size_t m_expected_size;
+    std::size_t m_actual_size;
+    std::size_t m_tdata_mismatches;
+    std::size_t m_tuser_mismatches;
+    bool m_tid_mismatch;
+    bool m_tdest_mismatch;
+    bool m_tuser_size_mismatch;
+    std::string m_tid;
+    std::string m_tdest;
+    std::vector<std::size_t> m_tuser;
+    std::vector<difference> m_differences;
+    std::vector<std::uint8_t> m_expected_data;
+    std::vector<std::uint8_t> m_expected_types;
+    std::vector<std::uint8_t> m_actual_data;
+    std::vector<std::uint8_t> m_actual_types;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_PACKET_DIFF_HPP */
@@ -0,0 +1,111 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_PACKET_WRITER_HPP
+#define LOGIC_AXI4_STREAM_PACKET_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace logic {
+
+class bitstream;
+
+namespace axi4 {
+namespace stream {
+
+class packet;
+
+/* Class: logic::axi4::stream::packet_writer
+ *
+ * Writes packets to an output stream in a selected format:
+ *
+ *  json    - pretty-printed document produced by <logic::printer::json>
+ *  ndjson  - single line JSON object per packet with encoded payload
+ *  msgpack - MessagePack map per packet with binary payload
+ *
+ * Compact formats store tdata bytes as a single base64 or hex string.
+ */
+class packet_writer {
+public:
+    enum format_t {
+        JSON,
+        NDJSON,
+        MSGPACK
+    };
+
+    enum encoding_t {
+        BASE64,
+        HEX
+    };
+
+    packet_writer(std::ostream& output, format_t format,
+            encoding_t encoding = BASE64);
+
+    void write(const packet& value);
+
+    void flush();
+
+    static bool to_format(const std::string& name, format_t& format) noexcept;
+
+    static bool to_encoding(const std::string& name,
+            encoding_t& encoding) noexcept;
+
+    packet_writer(packet_writer&&) = delete;
+
+    packet_writer(const packet_writer&) = delete;
+
+    packet_writer& operator=(packet_writer&&) = delete;
+
+    packet_writer& operator=(const packet_writer&) = delete;
+
+    ~packet_writer();
+private:
+    void print_json(const packet& value);
+
+    void write_ndjson(const packet& value);
+
+    void write_msgpack(const packet& value);
+
+    void encode(const std::uint8_t* data, std::size_t size);
+
+    void hex(const bitstream& bits);
+
+    void msgpack_string(const std::string& value);
+
+    void msgpack_binary(const std::uint8_t* data, std::size_t size);
+
+    void msgpack_unsigned(std::uint64_t value);
+
+    void msgpack_array(std::size_t size);
+
+    void msgpack_size(std::uint8_t type, std::size_t size,
+            std::size_t count);
+
+    std::ostream& m_output;
+    format_t m_format;
+    encoding_t m_encoding;
+    std::string m_buffer;
+    std::vector<std::uint8_t> m_bytes;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_PACKET_WRITER_HPP */
@@ -0,0 +1,97 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_PROTOCOL_CHECKER_HPP
+#define LOGIC_AXI4_STREAM_PROTOCOL_CHECKER_HPP
+
+#include "logic/bitstream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+class bus_if_base;
+
+/* Class: logic::axi4::stream::protocol_checker
+ *
+ * Checks AXI4-Stream protocol rules on every sampled clock cycle:
+ *
+ *  - tvalid once asserted stays asserted until handshake
+ *  - tdata, tkeep and tstrb are stable while transfer is stalled
+ *  - tlast, tid, tdest and tuser are stable while transfer is stalled
+ *  - tkeep deasserted with tstrb asserted (reserved byte) is not used
+ *
+ * Beat is stored bit-packed only when transfer becomes stalled, following
+ * stalled cycles are compared with it in place. Cycles without valid
+ * transfer cost only tvalid and tready reads.
+ */
+class protocol_checker {
+public:
+    enum violation_t {
+        NONE,
+        TVALID_DEASSERTED,
+        PAYLOAD_CHANGED,
+        SIDEBAND_CHANGED,
+        RESERVED_BYTE
+    };
+
+    explicit protocol_checker(const bus_if_base& vif);
+
+    violation_t check();
+
+    void reset() noexcept;
+
+    static const char* to_string(violation_t violation) noexcept;
+
+    protocol_checker(protocol_checker&&) = delete;
+
+    protocol_checker(const protocol_checker&) = delete;
+
+    protocol_checker& operator=(protocol_checker&&) = delete;
+
+    protocol_checker& operator=(const protocol_checker&) = delete;
+
+    ~protocol_checker();
+private:
+    struct beat {
+        std::vector<std::uint64_t> tdata{};
+        std::vector<std::uint64_t> tkeep{};
+        std::vector<std::uint64_t> tstrb{};
+        bool tlast{false};
+        bitstream tid{};
+        bitstream tdest{};
+        bitstream tuser{};
+    };
+
+    void sample();
+
+    bool payload_changed() const;
+
+    bool sideband_changed() const;
+
+    const bus_if_base& m_vif;
+    beat m_previous{};
+    bool m_stalled{false};
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_PROTOCOL_CHECKER_HPP */
@@ -0,0 +1,128 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_RECORDER_HPP
+#define LOGIC_AXI4_STREAM_RECORDER_HPP
+
+#include "packet.hpp"
+
+#include <uvm>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+/* Class: logic::axi4::stream::recorder
+ *
+ * Subscriber that appends every received packet to a binary transaction log.
+ * Packets are encoded into a front buffer by the simulation thread. Full
+ * buffers are swapped with a back buffer that is written to a file by
+ * a dedicated writer thread, so simulation never waits for a disk.
+ *
+ * Configuration:
+ *  filename    - transaction log file name, recording disabled when empty
+ *  buffer_size - size in bytes of a buffer that triggers buffers swap
+ */
+class recorder : public uvm::uvm_subscriber<packet> {
+public:
+    UVM_COMPONENT_UTILS(logic::axi4::stream::recorder)
+
+    recorder();
+
+    explicit recorder(const uvm::uvm_component_name& component_name);
+
+    void write(const packet& value) override;
+
+    std::size_t records() const noexcept;
+
+    recorder(recorder&&) = delete;
+
+    recorder(const recorder&) = delete;
+
+    recorder& operator=(recorder&&) = delete;
+
+    recorder& operator=(const recorder&) = delete;
+
+    ~recorder() override;
+protected:
+    void build_phase(uvm::uvm_phase& phase) override;
+
+    void final_phase(uvm::uvm_phase& phase) override;
+private:
+    void open();
+
+    void close();
+
+    void flush();
+
+    void writer();
+
+    std::string m_filename;
+    std::size_t m_buffer_size;
+    std::size_t m_records;
+    std::ofstream m_file;
+    std::vector<std::uint8_t> m_front;
+    std::vector<std::uint8_t> m_back;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::thread m_thread;
+    bool m_pending;
+    bool m_done;
+};
+
+/* Class: logic::axi4::stream::record_reader
+ *
+ * Reads packets back from a binary transaction log created by the
+ * <logic::axi4::stream::recorder>.
+ */
+class record_reader {
+public:
+    explicit record_reader(const std::string& filename);
+
+    bool read(packet& value);
+
+    std::size_t records() const noexcept;
+
+    record_reader(record_reader&&) = delete;
+
+    record_reader(const record_reader&) = delete;
+
+    record_reader& operator=(record_reader&&) = delete;
+
+    record_reader& operator=(const record_reader&) = delete;
+
+    ~record_reader();
+private:
+    std::ifstream m_file;
+    std::vector<std::uint8_t> m_buffer;
+    std::uint64_t m_resolution;
+    std::size_t m_records;
+    std::string m_filename;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_RECORDER_HPP */
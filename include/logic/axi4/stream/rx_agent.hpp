@@ -22,6 +22,7 @@ namespace logic {
 namespace axi4 {
 namespace stream {
 
+class beat;
 class packet;
 class monitor;
 class rx_driver;
@@ -46,6 +47,7 @@ public:
     ~rx_agent() override;
 
     uvm::uvm_analysis_port<packet> analysis_port;
+    uvm::uvm_analysis_port<beat> beat_analysis_port;
     rx_sequencer* sequencer;
 protected:
     void build_phase(uvm::uvm_phase& phase) override;
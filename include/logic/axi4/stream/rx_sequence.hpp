@@ -22,6 +22,7 @@
 #include <uvm>
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 namespace logic {
@@ -34,6 +35,9 @@ public:
 
     std::vector<rx_sequence_item> items;
 
+    /* When set, items are streamed from binary stimulus file instead */
+    std::string stimulus;
+
     rx_sequence();
 
     explicit rx_sequence(const std::string& name);
@@ -53,6 +57,8 @@ protected:
     void body() override;
 
     void post_body() override;
+private:
+    void stream_stimulus();
 };
 
 } /* namespace stream */
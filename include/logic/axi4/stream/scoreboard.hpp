@@ -16,17 +16,61 @@
 #ifndef LOGIC_AXI4_STREAM_SCOREBOARD_HPP
 #define LOGIC_AXI4_STREAM_SCOREBOARD_HPP
 
+#include "beat.hpp"
 #include "packet.hpp"
+#include "packet_diff.hpp"
+#include "stream_diff.hpp"
 
 #include <tlm>
 #include <uvm>
 
 #include <cstddef>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
 
 namespace logic {
 namespace axi4 {
 namespace stream {
 
+class compare_pool;
+class packet_writer;
+
+/* Class: logic::axi4::stream::scoreboard
+ *
+ * Compares Rx and Tx packets. Every mismatch is reported as a bounded diff
+ * of the first differences, full packets are dumped only on request.
+ *
+ * In streaming mode packets are compared beat by beat with
+ * <logic::axi4::stream::stream_diff> as monitors sample them, memory usage
+ * does not depend on packet size. Mismatched packets cannot be dumped and
+ * packets cannot be interleaved, a tid or tdest change within a packet is
+ * reported as a mismatch.
+ *
+ * Configuration:
+ *  mismatch_format      - none (default), json, ndjson or msgpack
+ *  mismatch_encoding    - tdata encoding for ndjson: base64 (default) or hex
+ *  mismatch_filename    - mismatched packets output file, standard output
+ *                         when not set
+ *  mismatch_differences - maximum number of reported differences
+ *  mismatch_context     - number of bytes shown around the first difference
+ *  streaming            - compare beats instead of whole packets, must be
+ *                         set for monitors too
+ *  stream_lookahead     - maximum number of beats buffered for one side
+ *                         ahead of the other, 65536 by default. Beats
+ *                         written beyond it are dropped and reported
+ *  compare_workers      - number of threads comparing packets off the
+ *                         simulation thread, 0 (default) compares in place
+ *  compare_depth        - maximum number of packet pairs in flight per
+ *                         worker thread, 16 by default
+ *
+ * With compare workers a mismatch is reported, and the trace is triggered,
+ * when its verdict is collected, not when the mismatching packet was
+ * received. Verdicts are collected after every submitted packet pair and
+ * in the extract phase, so reporting can lag up to compare_workers times
+ * compare_depth packet pairs behind. Trace ring must cover that delay.
+ */
 class scoreboard : public uvm::uvm_scoreboard {
 public:
     UVM_COMPONENT_UTILS(logic::axi4::stream::scoreboard)
@@ -51,17 +95,56 @@ public:
 
     uvm::uvm_analysis_export<packet> rx_analysis_export;
     uvm::uvm_analysis_export<packet> tx_analysis_export;
+    uvm::uvm_analysis_export<beat> rx_beat_analysis_export;
+    uvm::uvm_analysis_export<beat> tx_beat_analysis_export;
 protected:
+    void build_phase(uvm::uvm_phase& phase) override;
+
     void connect_phase(uvm::uvm_phase& phase) override;
 
     [[noreturn]] void run_phase(uvm::uvm_phase& phase) override;
 
+    void extract_phase(uvm::uvm_phase& phase) override;
+
+    [[noreturn]] void run_streaming();
+
+    [[noreturn]] void run_pool();
+
+    std::size_t collect(bool wait,
+            std::size_t limit = std::numeric_limits<std::size_t>::max());
+
+    /* Beat FIFO that drops beats written beyond its capacity */
+    class beat_fifo : public tlm::tlm_analysis_fifo<beat> {
+    public:
+        explicit beat_fifo(const char* name);
+
+        void write(const beat& value) override;
+
+        std::size_t capacity;
+        std::size_t dropped;
+    };
+
+    void mismatch(const std::string& report, packet& rx, packet& tx);
+
     bool m_error;
     tlm::tlm_analysis_fifo<packet> m_rx_fifo;
     tlm::tlm_analysis_fifo<packet> m_tx_fifo;
 
     packet* m_rx_packet;
     packet* m_tx_packet;
+    packet_diff m_diff;
+
+    bool m_streaming;
+    std::size_t m_lookahead;
+    beat_fifo m_rx_beat_fifo;
+    beat_fifo m_tx_beat_fifo;
+    beat m_beat;
+    stream_diff m_stream_diff;
+
+    std::unique_ptr<compare_pool> m_pool;
+
+    std::ofstream m_mismatch_file;
+    std::unique_ptr<packet_writer> m_mismatch_writer;
 };
 
 } /* namespace stream */
@@ -0,0 +1,106 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_STIMULUS_HPP
+#define LOGIC_AXI4_STREAM_STIMULUS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+class rx_sequence_item;
+
+/* Class: logic::axi4::stream::stimulus_writer
+ *
+ * Writes Rx sequence items to a compact binary stimulus file. Every item is
+ * stored as a single self-contained record with packet payload, sideband
+ * signals and idle schedule. File can be replayed later by the
+ * <logic::axi4::stream::stimulus_reader>.
+ */
+class stimulus_writer {
+public:
+    explicit stimulus_writer(const std::string& filename);
+
+    void write(const rx_sequence_item& item);
+
+    void close();
+
+    std::size_t records() const noexcept;
+
+    std::size_t packets() const noexcept;
+
+    stimulus_writer(stimulus_writer&&) = delete;
+
+    stimulus_writer(const stimulus_writer&) = delete;
+
+    stimulus_writer& operator=(stimulus_writer&&) = delete;
+
+    stimulus_writer& operator=(const stimulus_writer&) = delete;
+
+    ~stimulus_writer();
+private:
+    std::ofstream m_file;
+    std::vector<std::uint8_t> m_buffer;
+    std::size_t m_records;
+    std::size_t m_packets;
+};
+
+/* Class: logic::axi4::stream::stimulus_reader
+ *
+ * Memory-maps binary stimulus file and decodes records one by one on demand.
+ * No items are created up front.
+ */
+class stimulus_reader {
+public:
+    explicit stimulus_reader(const std::string& filename);
+
+    bool read(rx_sequence_item& item);
+
+    void rewind() noexcept;
+
+    std::size_t records() const noexcept;
+
+    std::size_t packets() const noexcept;
+
+    stimulus_reader(stimulus_reader&&) = delete;
+
+    stimulus_reader(const stimulus_reader&) = delete;
+
+    stimulus_reader& operator=(stimulus_reader&&) = delete;
+
+    stimulus_reader& operator=(const stimulus_reader&) = delete;
+
+    ~stimulus_reader();
+private:
+    const std::uint8_t* m_begin;
+    const std::uint8_t* m_end;
+    const std::uint8_t* m_position;
+    std::size_t m_size;
+    std::size_t m_records;
+    std::size_t m_packets;
+    std::string m_filename;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_STIMULUS_HPP */
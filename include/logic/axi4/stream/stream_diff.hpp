@@ -0,0 +1,123 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_AXI4_STREAM_STREAM_DIFF_HPP
+#define LOGIC_AXI4_STREAM_STREAM_DIFF_HPP
+
+#include "logic/bitstream.hpp"
+#include "packet_diff.hpp"
+#include "tdata_byte.hpp"
+
+#include <systemc>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+
+class beat;
+
+/* Class: logic::axi4::stream::stream_diff
+ *
+ * Compares expected and actual packets beat by beat, as they arrive,
+ * without materializing them. Only the bytes and tuser transfers that one
+ * side has ahead of the other are buffered. <next> tells which side must be
+ * fed to keep that lookahead within a single beat. Per packet only sizes,
+ * running FNV-1a hashes of tdata and the first mismatch positions are kept.
+ * Packets cannot be interleaved, a beat with tid or tdest different from
+ * the packet in progress makes the packets unequal.
+ */
+class stream_diff {
+public:
+    enum side_t {
+        EXPECTED,
+        ACTUAL
+    };
+
+    using difference = packet_diff::difference;
+
+    explicit stream_diff(std::size_t max_differences = 8);
+
+    void push(side_t side, const beat& value);
+
+    side_t next() const noexcept;
+
+    bool done() const noexcept;
+
+    bool equal() const noexcept;
+
+    std::size_t size(side_t side) const noexcept;
+
+    std::uint64_t hash(side_t side) const noexcept;
+
+    const std::vector<difference>& differences() const noexcept;
+
+    std::string report() const;
+
+    void clear();
+
+    stream_diff(stream_diff&&) = default;
+
+    stream_diff(const stream_diff&) = default;
+
+    stream_diff& operator=(stream_diff&&) = default;
+
+    stream_diff& operator=(const stream_diff&) = default;
+
+    ~stream_diff();
+private:
+    struct state {
+        std::size_t size{0};
+        std::size_t transfers{0};
+        std::uint64_t hash{0};
+        bitstream tid{};
+        bitstream tdest{};
+        bool interleaved{false};
+        bool done{false};
+    };
+
+    void compare_tuser(side_t side, const bitstream& tuser);
+
+    void compare_tdata(side_t side, const tdata_byte& value,
+            const sc_core::sc_time& timestamp);
+
+    std::size_t m_max_differences;
+    std::array<state, 2> m_state;
+    std::deque<tdata_byte> m_pending_tdata;
+    std::deque<bitstream> m_pending_tuser;
+    side_t m_tdata_side;
+    side_t m_tuser_side;
+    std::size_t m_offset;
+    std::size_t m_transfer;
+    std::size_t m_tdata_mismatches;
+    std::size_t m_tuser_mismatches;
+    std::vector<std::size_t> m_tuser;
+    std::vector<difference> m_differences;
+    sc_core::sc_time m_first_mismatch;
+    bool m_tid_mismatch;
+    bool m_tdest_mismatch;
+};
+
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* LOGIC_AXI4_STREAM_STREAM_DIFF_HPP */
@@ -27,6 +27,7 @@ class tx_agent;
 class sequencer;
 class scoreboard;
 class reset_agent;
+class recorder;
 
 class testbench : public uvm::uvm_env {
 public:
@@ -60,6 +61,8 @@ protected:
     tx_agent* m_tx_agent;
     scoreboard* m_scoreboard;
     reset_agent* m_reset_agent;
+    recorder* m_rx_recorder;
+    recorder* m_tx_recorder;
 };
 
 } /* namespace stream */
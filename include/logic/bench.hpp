@@ -0,0 +1,67 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_BENCH_HPP
+#define LOGIC_BENCH_HPP
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace logic {
+
+/* Class: logic::bench
+ *
+ * Simulation benchmark enabled by the +logic_bench command line argument.
+ * It measures wall time, simulated aclk cycles, delta cycles, cycles per
+ * second and peak resident set size. Summary is printed as a single JSON
+ * line at the end of simulation and optionally written to a file given by
+ * +logic_bench=<filename>.
+ */
+class bench : public sc_core::sc_module {
+public:
+    static void enable(const std::string& filename = {});
+
+    bench(const sc_core::sc_module_name& name, const std::string& filename);
+
+    void report();
+
+    bench(bench&&) = delete;
+
+    bench(const bench&) = delete;
+
+    bench& operator=(bench&&) = delete;
+
+    bench& operator=(const bench&) = delete;
+
+    ~bench() override;
+protected:
+    void start_of_simulation() override;
+
+    void end_of_simulation() override;
+private:
+    bool m_reported{false};
+    std::string m_filename;
+    std::uint64_t m_delta_cycles{0};
+    sc_core::sc_time m_time{};
+    sc_core::sc_time m_period{};
+    std::chrono::steady_clock::time_point m_start{};
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_BENCH_HPP */
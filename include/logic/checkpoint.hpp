@@ -0,0 +1,80 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_CHECKPOINT_HPP
+#define LOGIC_CHECKPOINT_HPP
+
+#include <functional>
+#include <string>
+
+namespace logic {
+
+/* Class: logic::checkpoint
+ *
+ * Saves and restores simulation state at named checkpoint points, so tests
+ * can skip reset sequencing and warm-up traffic. Every participant, like
+ * Verilated model or testbench component, registers save and restore
+ * callbacks that write and read own file in the checkpoint directory. DUT
+ * models are registered by <add_model>, at least one is required, otherwise
+ * saving or restoring is a fatal error because restored DUT would never be
+ * reset.
+ *
+ * Enabled by the command line arguments:
+ *
+ *   +logic_checkpoint_save=<directory>    - save state at the point
+ *   +logic_checkpoint_restore=<directory> - restore state at the point
+ *   +logic_checkpoint=<point>             - point name, default reset
+ *
+ * Point is reached in testbench code by:
+ *
+ * (start code)
+ * if (!logic::checkpoint::restore("reset")) {
+ *     reset->start(m_reset_sequencer);
+ *     logic::checkpoint::save("reset");
+ * }
+ * (end)
+ *
+ * Every point is saved or restored only once per simulation. SystemC
+ * simulation time is not restored, it continues from the current value.
+ * Save directory gets the output suffix of <logic::test_server> children,
+ * see <logic::get_output_filename>, so forked tests never write to the same
+ * directory.
+ */
+class checkpoint {
+public:
+    using callback = std::function<void(const std::string& filename)>;
+
+    static void add(const std::string& name, const callback& save,
+            const callback& restore);
+
+    static void add_model(const std::string& name, const callback& save,
+            const callback& restore);
+
+    static void set_point(const std::string& point);
+
+    static void enable_save(const std::string& directory);
+
+    static void enable_restore(const std::string& directory);
+
+    static bool save(const std::string& point);
+
+    static bool restore(const std::string& point);
+
+    checkpoint() = delete;
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_CHECKPOINT_HPP */
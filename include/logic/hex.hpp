@@ -0,0 +1,80 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_HEX_HPP
+#define LOGIC_HEX_HPP
+
+#include "bitstream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace logic {
+namespace hex {
+
+/* Function: digit
+ *
+ * Returns lowercase hexadecimal digit of the lowest nibble of value.
+ */
+inline char digit(unsigned value) noexcept {
+    static const char digits[] = "0123456789abcdef";
+
+    return digits[value & 0xFu];
+}
+
+/* Function: append
+ *
+ * Appends byte value as two lowercase hexadecimal digits.
+ */
+inline void append(std::string& output, std::uint8_t value) {
+    output.push_back(digit(unsigned(value) >> 4));
+    output.push_back(digit(value));
+}
+
+/* Function: append
+ *
+ * Appends bitstream as 0x prefixed hexadecimal number, most significant
+ * digit first.
+ */
+inline void append(std::string& output, const bitstream& bits) {
+    auto data = static_cast<const std::uint8_t*>(bits.data());
+    std::size_t index = (bits.size() + 3u) / 4u;
+
+    output.append("0x");
+
+    if (0u == index) {
+        output.push_back('0');
+    }
+
+    while (index > 0u) {
+        --index;
+        output.push_back(digit(unsigned(data[index / 2u]) >>
+                    (4u * (index % 2u))));
+    }
+}
+
+inline std::string to_string(const bitstream& bits) {
+    std::string output;
+
+    append(output, bits);
+
+    return output;
+}
+
+} /* namespace hex */
+} /* namespace logic */
+
+#endif /* LOGIC_HEX_HPP */
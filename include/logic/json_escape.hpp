@@ -0,0 +1,63 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_JSON_ESCAPE_HPP
+#define LOGIC_JSON_ESCAPE_HPP
+
+#include "hex.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace logic {
+
+/* Function: append_json_escaped
+ *
+ * Appends value as JSON string content without surrounding quotes. Quotes
+ * and backslashes are escaped with backslash, control characters as \u00XX.
+ */
+inline void append_json_escaped(std::string& output, const std::string& value) {
+    for (const auto c : value) {
+        const auto code = std::uint8_t(c);
+
+        if (('"' == c) || ('\\' == c)) {
+            output.push_back('\\');
+            output.push_back(c);
+        }
+        else if (code < 0x20) {
+            output.append("\\u00");
+            hex::append(output, code);
+        }
+        else {
+            output.push_back(c);
+        }
+    }
+}
+
+/* Function: escape_json
+ *
+ * Returns value escaped as JSON string content, see <append_json_escaped>.
+ */
+inline std::string escape_json(const std::string& value) {
+    std::string output;
+
+    append_json_escaped(output, value);
+
+    return output;
+}
+
+} /* namespace logic */
+
+#endif /* LOGIC_JSON_ESCAPE_HPP */
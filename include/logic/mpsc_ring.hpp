@@ -0,0 +1,306 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_MPSC_RING_HPP
+#define LOGIC_MPSC_RING_HPP
+
+#include "ring_wait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace logic {
+
+/* Class: logic::mpsc_ring
+ *
+ * Bounded lock-free multiple producer, single consumer ring buffer. Every
+ * slot carries a sequence number that tells whether it is free or filled
+ * for the current lap. Producers claim slots by advancing shared head with
+ * compare and swap and publish every slot separately, the only consumer
+ * pops slots in order. Capacity is rounded up to power of two and all slots
+ * are allocated up front.
+ *
+ * Interface and wait policies are the same as for <logic::spsc_ring>.
+ * Items from one producer batch are claimed together, so they are popped
+ * contiguously.
+ */
+template<typename T, typename Wait = spin_wait>
+class mpsc_ring {
+public:
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    explicit mpsc_ring(size_type capacity);
+
+    bool try_push(const value_type& value);
+
+    bool try_push(value_type&& value);
+
+    template<typename ForwardIt>
+    size_type try_push(ForwardIt first, size_type count);
+
+    bool try_pop(value_type& value);
+
+    template<typename OutputIt>
+    size_type try_pop(OutputIt first, size_type count);
+
+    void push(const value_type& value);
+
+    void push(value_type&& value);
+
+    template<typename ForwardIt>
+    void push(ForwardIt first, size_type count);
+
+    void pop(value_type& value);
+
+    template<typename OutputIt>
+    size_type pop(OutputIt first, size_type count);
+
+    bool empty() const noexcept;
+
+    size_type size() const noexcept;
+
+    size_type capacity() const noexcept;
+
+    mpsc_ring(mpsc_ring&&) = delete;
+
+    mpsc_ring(const mpsc_ring&) = delete;
+
+    mpsc_ring& operator=(mpsc_ring&&) = delete;
+
+    mpsc_ring& operator=(const mpsc_ring&) = delete;
+
+    ~mpsc_ring() = default;
+private:
+    struct slot {
+        std::atomic<size_type> sequence{0};
+        value_type value{};
+    };
+
+    static size_type round_up(size_type value) noexcept;
+
+    size_type claim(size_type& count) noexcept;
+
+    bool ready() const noexcept;
+
+    const size_type m_capacity;
+    const size_type m_mask;
+    std::unique_ptr<slot[]> m_slots;
+    char m_pad0[CACHE_LINE];
+    std::atomic<size_type> m_head;
+    char m_pad1[CACHE_LINE];
+    std::atomic<size_type> m_tail;
+    char m_pad2[CACHE_LINE];
+    Wait m_not_empty;
+    Wait m_not_full;
+};
+
+template<typename T, typename W>
+mpsc_ring<T, W>::mpsc_ring(size_type capacity) :
+    m_capacity{round_up(capacity)},
+    m_mask{m_capacity - 1u},
+    m_slots{new slot[m_capacity]},
+    m_pad0{},
+    m_head{0},
+    m_pad1{},
+    m_tail{0},
+    m_pad2{},
+    m_not_empty{},
+    m_not_full{}
+{
+    for (size_type i = 0u; i < m_capacity; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T, typename W> auto
+mpsc_ring<T, W>::round_up(size_type value) noexcept -> size_type {
+    size_type rounded = 1u;
+
+    while (rounded < value) {
+        rounded <<= 1u;
+    }
+
+    return rounded;
+}
+
+/*
+ * Consumer frees slots in order, so all positions below tail plus capacity
+ * are free for producers. Returns first claimed position, count is updated
+ * with number of claimed slots.
+ */
+template<typename T, typename W> auto
+mpsc_ring<T, W>::claim(size_type& count) noexcept -> size_type {
+    while (true) {
+        const auto tail = m_tail.load(std::memory_order_acquire);
+        auto head = m_head.load(std::memory_order_relaxed);
+        const auto used = head - tail;
+        const auto available = (used < m_capacity) ? (m_capacity - used) : 0u;
+
+        if (count > available) {
+            count = available;
+        }
+
+        if (0u == count) {
+            return head;
+        }
+
+        if (m_head.compare_exchange_weak(head, head + count,
+                    std::memory_order_relaxed)) {
+            return head;
+        }
+    }
+}
+
+template<typename T, typename W> bool
+mpsc_ring<T, W>::try_push(const value_type& value) {
+    return 1u == try_push(&value, 1u);
+}
+
+template<typename T, typename W> bool
+mpsc_ring<T, W>::try_push(value_type&& value) {
+    return 1u == try_push(std::make_move_iterator(&value), 1u);
+}
+
+template<typename T, typename W>
+template<typename ForwardIt> auto
+mpsc_ring<T, W>::try_push(ForwardIt first, size_type count) -> size_type {
+    auto claimed = count;
+    const auto head = claim(claimed);
+
+    if (0u == claimed) {
+        return 0u;
+    }
+
+    for (size_type i = 0u; i < claimed; ++i, ++first) {
+        auto& current = m_slots[(head + i) & m_mask];
+
+        current.value = *first;
+        current.sequence.store(head + i + 1u, std::memory_order_release);
+    }
+
+    m_not_empty.notify();
+
+    return claimed;
+}
+
+template<typename T, typename W> bool
+mpsc_ring<T, W>::try_pop(value_type& value) {
+    return 1u == try_pop(&value, 1u);
+}
+
+template<typename T, typename W>
+template<typename OutputIt> auto
+mpsc_ring<T, W>::try_pop(OutputIt first, size_type count) -> size_type {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    size_type popped = 0u;
+
+    for (; popped < count; ++popped, ++first) {
+        const auto position = tail + popped;
+        auto& current = m_slots[position & m_mask];
+
+        if (current.sequence.load(std::memory_order_acquire) !=
+                (position + 1u)) {
+            break;
+        }
+
+        *first = std::move(current.value);
+        current.sequence.store(position + m_capacity,
+                std::memory_order_release);
+    }
+
+    if (0u != popped) {
+        m_tail.store(tail + popped, std::memory_order_release);
+        m_not_full.notify();
+    }
+
+    return popped;
+}
+
+template<typename T, typename W> void
+mpsc_ring<T, W>::push(const value_type& value) {
+    push(&value, 1u);
+}
+
+template<typename T, typename W> void
+mpsc_ring<T, W>::push(value_type&& value) {
+    push(std::make_move_iterator(&value), 1u);
+}
+
+template<typename T, typename W>
+template<typename ForwardIt> void
+mpsc_ring<T, W>::push(ForwardIt first, size_type count) {
+    while (count > 0u) {
+        m_not_full.wait([this] {
+            const auto tail = m_tail.load(std::memory_order_acquire);
+            return (m_head.load(std::memory_order_relaxed) - tail) <
+                m_capacity;
+        });
+
+        const auto pushed = try_push(first, count);
+
+        std::advance(first, pushed);
+        count -= pushed;
+    }
+}
+
+template<typename T, typename W> void
+mpsc_ring<T, W>::pop(value_type& value) {
+    pop(&value, 1u);
+}
+
+template<typename T, typename W>
+template<typename OutputIt> auto
+mpsc_ring<T, W>::pop(OutputIt first, size_type count) -> size_type {
+    if (0u == count) {
+        return 0u;
+    }
+
+    m_not_empty.wait([this] { return ready(); });
+
+    return try_pop(first, count);
+}
+
+template<typename T, typename W> bool
+mpsc_ring<T, W>::ready() const noexcept {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+
+    return m_slots[tail & m_mask].sequence.load(std::memory_order_acquire) ==
+        (tail + 1u);
+}
+
+template<typename T, typename W> bool
+mpsc_ring<T, W>::empty() const noexcept {
+    return 0u == size();
+}
+
+template<typename T, typename W> auto
+mpsc_ring<T, W>::size() const noexcept -> size_type {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return m_head.load(std::memory_order_acquire) - tail;
+}
+
+template<typename T, typename W> auto
+mpsc_ring<T, W>::capacity() const noexcept -> size_type {
+    return m_capacity;
+}
+
+} /* namespace logic */
+
+#endif /* LOGIC_MPSC_RING_HPP */
@@ -0,0 +1,42 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_OUTPUT_FILE_HPP
+#define LOGIC_OUTPUT_FILE_HPP
+
+#include <string>
+
+namespace logic {
+
+/* Function: set_output_suffix
+ *
+ * Sets suffix added to names of output files like transaction logs,
+ * mismatch, benchmark and profile files. <logic::test_server> sets it to
+ * <test>_<seed> in every forked child, so concurrently running tests never
+ * write to the same file.
+ */
+void set_output_suffix(const std::string& suffix);
+
+/* Function: get_output_filename
+ *
+ * Returns filename with output suffix inserted before file extension, for
+ * example mismatch.json becomes mismatch_basic_test_1.json. Without suffix
+ * filename is returned unchanged.
+ */
+std::string get_output_filename(const std::string& filename);
+
+} /* namespace logic */
+
+#endif /* LOGIC_OUTPUT_FILE_HPP */
@@ -18,14 +18,27 @@
 
 #include <uvm>
 
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace logic {
 namespace printer {
 
+/* Class: logic::printer::json
+ *
+ * UVM printer that formats JSON directly while do_print() callbacks are
+ * invoked, without collecting intermediate uvm_printer_row_info rows. Output
+ * is accumulated in a reusable buffer and returned by emit() or, when an
+ * output stream is given, written to it in chunks.
+ */
 class json : public uvm::uvm_printer {
 public:
-    json() = default;
+    json();
+
+    explicit json(std::ostream& output);
 
     json(json&&) = default;
 
@@ -35,9 +48,79 @@ public:
 
     json& operator=(const json&) = default;
 
+    void print_field(const std::string& name,
+            const uvm::uvm_bitstream_t& value, int size = -1,
+            uvm::uvm_radix_enum radix = uvm::UVM_NORADIX,
+            const char* scope_separator = ".",
+            const std::string& type_name = "") const override;
+
+    void print_field_int(const std::string& name,
+            const uvm::uvm_integral_t& value, int size = -1,
+            uvm::uvm_radix_enum radix = uvm::UVM_NORADIX,
+            const char* scope_separator = ".",
+            const std::string& type_name = "") const override;
+
+    void print_object(const std::string& name,
+            const uvm::uvm_object& value,
+            const char* scope_separator = ".") const override;
+
+    void print_object_header(const std::string& name,
+            const uvm::uvm_object& value,
+            const char* scope_separator = ".") const override;
+
+    void print_string(const std::string& name, const std::string& value,
+            const char* scope_separator = ".") const override;
+
+    void print_time(const std::string& name, const sc_core::sc_time& value,
+            const char* scope_separator = ".") const override;
+
+    void print_real(const std::string& name, double value,
+            const char* scope_separator = ".") const override;
+
+    void print_generic(const std::string& name, const std::string& type_name,
+            int size, const std::string& value,
+            const char* scope_separator = ".") const override;
+
+    void print_array_header(const std::string& name, int size,
+            const std::string& arraytype = "array",
+            const char* scope_separator = ".") const override;
+
+    void print_array_footer(int size = 0) const override;
+
     std::string emit() override;
 
     ~json() override;
+private:
+    enum container_t : std::uint8_t {
+        OBJECT,
+        ARRAY
+    };
+
+    void key(const std::string& name) const;
+
+    void open(const std::string& name, container_t container) const;
+
+    void close() const;
+
+    void quoted(const std::string& value) const;
+
+    void unsigned_integer(std::uint64_t value) const;
+
+    template<typename T>
+    void integral(const T& value, int size, uvm::uvm_radix_enum radix) const;
+
+    template<typename T>
+    void hex(const T& value, int size) const;
+
+    template<typename T>
+    void bin(const T& value, int size) const;
+
+    void flush() const;
+
+    mutable std::string m_buffer;
+    mutable std::vector<container_t> m_containers;
+    mutable bool m_first;
+    std::ostream* m_output;
 };
 
 } /* namespace printer */
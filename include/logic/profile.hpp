@@ -0,0 +1,94 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_PROFILE_HPP
+#define LOGIC_PROFILE_HPP
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/* Define: LOGIC_PROFILE_SCOPE
+ *
+ * Starts named timer in member function of SystemC object. Timer is stopped
+ * at the end of scope or by <LOGIC_PROFILE_STOP>, which must be called
+ * before any wait() to not account time of other processes. Name must be
+ * a string literal. Expands to nothing when LOGIC_PROFILE is not defined.
+ */
+#if defined(LOGIC_PROFILE)
+#define LOGIC_PROFILE_SCOPE(timer, name) \
+    logic::profile::scope timer{this, name}
+#define LOGIC_PROFILE_STOP(timer) \
+    timer.stop()
+#define LOGIC_PROFILE_COUNT(name, value) \
+    logic::profile::count(this, name, value)
+#else
+#define LOGIC_PROFILE_SCOPE(timer, name) static_cast<void>(0)
+#define LOGIC_PROFILE_STOP(timer) static_cast<void>(0)
+#define LOGIC_PROFILE_COUNT(name, value) static_cast<void>(0)
+#endif
+
+namespace logic {
+
+/* Class: logic::profile
+ *
+ * Accumulates wall time and counters per SystemC object and site name.
+ * Summary is created by <summary> and every timed scope can be recorded as
+ * Chrome trace event when enabled by +logic_profile=<filename>.
+ */
+class profile {
+public:
+    using clock = std::chrono::steady_clock;
+
+    class scope {
+    public:
+        scope(const sc_core::sc_object* owner, const char* name);
+
+        void stop();
+
+        scope(scope&&) = delete;
+
+        scope(const scope&) = delete;
+
+        scope& operator=(scope&&) = delete;
+
+        scope& operator=(const scope&) = delete;
+
+        ~scope();
+    private:
+        const sc_core::sc_object* m_owner;
+        const char* m_name;
+        bool m_running{true};
+        clock::time_point m_start;
+    };
+
+    static void enable_trace(const std::string& filename);
+
+    static void count(const sc_core::sc_object* owner, const char* name,
+            std::uint64_t value = 1);
+
+    static void record(const sc_core::sc_object* owner, const char* name,
+            clock::time_point start, clock::time_point end);
+
+    static std::string summary();
+
+    static void write_trace();
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_PROFILE_HPP */
@@ -0,0 +1,155 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_RING_WAIT_HPP
+#define LOGIC_RING_WAIT_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+#if defined(__SANITIZE_THREAD__)
+#define LOGIC_RING_WAIT_TSAN 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define LOGIC_RING_WAIT_TSAN 1
+#endif
+#endif
+
+namespace logic {
+
+/* Constant: CACHE_LINE
+ *
+ * Assumed cache line size in bytes, used for padding between data written
+ * by different threads.
+ */
+static constexpr std::size_t CACHE_LINE{64};
+
+/* Function: cpu_relax
+ *
+ * Hints CPU that caller is in a busy wait loop.
+ */
+inline void cpu_relax() noexcept {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/* Class: logic::spin_wait
+ *
+ * Ring wait policy that busy waits: pause hints first, then yields the
+ * thread. Lowest latency, but waiting thread keeps its core busy. <notify>
+ * costs nothing.
+ */
+class spin_wait {
+public:
+    static constexpr unsigned SPINS{64};
+
+    template<typename Predicate>
+    void wait(Predicate ready);
+
+    void notify() noexcept { }
+};
+
+/* Class: logic::blocking_wait
+ *
+ * Ring wait policy that spins shortly and then sleeps on a condition
+ * variable. <notify> takes the lock only when some thread sleeps, so
+ * uncontended push and pop stay lock-free. ThreadSanitizer does not model
+ * fences, with it <notify> always takes the lock.
+ */
+class blocking_wait {
+public:
+    static constexpr unsigned SPINS{64};
+
+    blocking_wait() = default;
+
+    template<typename Predicate>
+    void wait(Predicate ready);
+
+    void notify();
+
+    blocking_wait(blocking_wait&&) = delete;
+
+    blocking_wait(const blocking_wait&) = delete;
+
+    blocking_wait& operator=(blocking_wait&&) = delete;
+
+    blocking_wait& operator=(const blocking_wait&) = delete;
+
+    ~blocking_wait() = default;
+private:
+    std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    std::atomic<std::size_t> m_waiters{0};
+};
+
+template<typename Predicate> void
+spin_wait::wait(Predicate ready) {
+    for (unsigned i = 0u; !ready(); ++i) {
+        if (i < SPINS) {
+            cpu_relax();
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<typename Predicate> void
+blocking_wait::wait(Predicate ready) {
+    for (unsigned i = 0u; i < SPINS; ++i) {
+        if (ready()) {
+            return;
+        }
+        cpu_relax();
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+
+    m_waiters.fetch_add(1);
+#if !defined(LOGIC_RING_WAIT_TSAN)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+
+    m_condition.wait(lock, ready);
+
+    m_waiters.fetch_sub(1);
+}
+
+inline void blocking_wait::notify() {
+#if !defined(LOGIC_RING_WAIT_TSAN)
+    /* Pairs with fence in wait, either waiter is seen or it sees new state */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (0 == m_waiters.load(std::memory_order_relaxed)) {
+        return;
+    }
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+    }
+
+    m_condition.notify_all();
+}
+
+} /* namespace logic */
+
+#endif /* LOGIC_RING_WAIT_HPP */
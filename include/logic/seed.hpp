@@ -0,0 +1,43 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_SEED_HPP
+#define LOGIC_SEED_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace logic {
+
+/* Function: set_seed
+ *
+ * Sets global random seed, also set by the +logic_seed=<value> command line
+ * argument. Without it every <get_seed> call returns a random value.
+ */
+void set_seed(std::uint32_t value) noexcept;
+
+bool has_seed() noexcept;
+
+/* Function: get_seed
+ *
+ * Returns seed for random generator of given scope, usually full component
+ * name. With global seed set, it is derived from the seed and the scope, so
+ * every component has own reproducible random sequence.
+ */
+std::uint32_t get_seed(const std::string& scope);
+
+} /* namespace logic */
+
+#endif /* LOGIC_SEED_HPP */
@@ -0,0 +1,283 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_SPSC_RING_HPP
+#define LOGIC_SPSC_RING_HPP
+
+#include "ring_wait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace logic {
+
+/* Class: logic::spsc_ring
+ *
+ * Bounded lock-free single producer, single consumer ring buffer. Capacity
+ * is rounded up to power of two and all slots are allocated up front, push
+ * and pop never allocate. Only one thread may push and only one other
+ * thread may pop.
+ *
+ * Producer and consumer indices are kept on separate cache lines, each side
+ * also caches the last seen index of the other side and reads the shared one
+ * only when the cached one says ring is full or empty.
+ *
+ * Try functions never wait. Blocking <push> and <pop> wait with Wait policy:
+ * <logic::spin_wait> (default) or <logic::blocking_wait>. Batch variants
+ * publish all transferred items with a single index update.
+ */
+template<typename T, typename Wait = spin_wait>
+class spsc_ring {
+public:
+    using value_type = T;
+
+    using size_type = std::size_t;
+
+    explicit spsc_ring(size_type capacity);
+
+    bool try_push(const value_type& value);
+
+    bool try_push(value_type&& value);
+
+    template<typename ForwardIt>
+    size_type try_push(ForwardIt first, size_type count);
+
+    bool try_pop(value_type& value);
+
+    template<typename OutputIt>
+    size_type try_pop(OutputIt first, size_type count);
+
+    void push(const value_type& value);
+
+    void push(value_type&& value);
+
+    template<typename ForwardIt>
+    void push(ForwardIt first, size_type count);
+
+    void pop(value_type& value);
+
+    template<typename OutputIt>
+    size_type pop(OutputIt first, size_type count);
+
+    bool empty() const noexcept;
+
+    size_type size() const noexcept;
+
+    size_type capacity() const noexcept;
+
+    spsc_ring(spsc_ring&&) = delete;
+
+    spsc_ring(const spsc_ring&) = delete;
+
+    spsc_ring& operator=(spsc_ring&&) = delete;
+
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    ~spsc_ring() = default;
+private:
+    static size_type round_up(size_type value) noexcept;
+
+    size_type writable() noexcept;
+
+    size_type readable() noexcept;
+
+    std::vector<value_type> m_buffer;
+    const size_type m_mask;
+    char m_pad0[CACHE_LINE];
+    std::atomic<size_type> m_head;
+    size_type m_tail_cache;
+    char m_pad1[CACHE_LINE];
+    std::atomic<size_type> m_tail;
+    size_type m_head_cache;
+    char m_pad2[CACHE_LINE];
+    Wait m_not_empty;
+    Wait m_not_full;
+};
+
+template<typename T, typename W>
+spsc_ring<T, W>::spsc_ring(size_type capacity) :
+    m_buffer(round_up(capacity)),
+    m_mask{m_buffer.size() - 1u},
+    m_pad0{},
+    m_head{0},
+    m_tail_cache{0},
+    m_pad1{},
+    m_tail{0},
+    m_head_cache{0},
+    m_pad2{},
+    m_not_empty{},
+    m_not_full{}
+{ }
+
+template<typename T, typename W> auto
+spsc_ring<T, W>::round_up(size_type value) noexcept -> size_type {
+    size_type rounded = 1u;
+
+    while (rounded < value) {
+        rounded <<= 1u;
+    }
+
+    return rounded;
+}
+
+template<typename T, typename W> auto
+spsc_ring<T, W>::writable() noexcept -> size_type {
+    const auto head = m_head.load(std::memory_order_relaxed);
+
+    if ((head - m_tail_cache) > m_mask) {
+        m_tail_cache = m_tail.load(std::memory_order_acquire);
+    }
+
+    return m_buffer.size() - (head - m_tail_cache);
+}
+
+template<typename T, typename W> auto
+spsc_ring<T, W>::readable() noexcept -> size_type {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail == m_head_cache) {
+        m_head_cache = m_head.load(std::memory_order_acquire);
+    }
+
+    return m_head_cache - tail;
+}
+
+template<typename T, typename W> bool
+spsc_ring<T, W>::try_push(const value_type& value) {
+    return 1u == try_push(&value, 1u);
+}
+
+template<typename T, typename W> bool
+spsc_ring<T, W>::try_push(value_type&& value) {
+    return 1u == try_push(std::make_move_iterator(&value), 1u);
+}
+
+template<typename T, typename W>
+template<typename ForwardIt> auto
+spsc_ring<T, W>::try_push(ForwardIt first, size_type count) -> size_type {
+    const auto available = writable();
+
+    if (count > available) {
+        count = available;
+    }
+
+    if (0u == count) {
+        return 0u;
+    }
+
+    const auto head = m_head.load(std::memory_order_relaxed);
+
+    for (size_type i = 0u; i < count; ++i, ++first) {
+        m_buffer[(head + i) & m_mask] = *first;
+    }
+
+    m_head.store(head + count, std::memory_order_release);
+    m_not_empty.notify();
+
+    return count;
+}
+
+template<typename T, typename W> bool
+spsc_ring<T, W>::try_pop(value_type& value) {
+    return 1u == try_pop(&value, 1u);
+}
+
+template<typename T, typename W>
+template<typename OutputIt> auto
+spsc_ring<T, W>::try_pop(OutputIt first, size_type count) -> size_type {
+    const auto available = readable();
+
+    if (count > available) {
+        count = available;
+    }
+
+    if (0u == count) {
+        return 0u;
+    }
+
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+
+    for (size_type i = 0u; i < count; ++i, ++first) {
+        *first = std::move(m_buffer[(tail + i) & m_mask]);
+    }
+
+    m_tail.store(tail + count, std::memory_order_release);
+    m_not_full.notify();
+
+    return count;
+}
+
+template<typename T, typename W> void
+spsc_ring<T, W>::push(const value_type& value) {
+    push(&value, 1u);
+}
+
+template<typename T, typename W> void
+spsc_ring<T, W>::push(value_type&& value) {
+    push(std::make_move_iterator(&value), 1u);
+}
+
+template<typename T, typename W>
+template<typename ForwardIt> void
+spsc_ring<T, W>::push(ForwardIt first, size_type count) {
+    while (count > 0u) {
+        m_not_full.wait([this] { return 0u != writable(); });
+
+        const auto pushed = try_push(first, count);
+
+        std::advance(first, pushed);
+        count -= pushed;
+    }
+}
+
+template<typename T, typename W> void
+spsc_ring<T, W>::pop(value_type& value) {
+    pop(&value, 1u);
+}
+
+template<typename T, typename W>
+template<typename OutputIt> auto
+spsc_ring<T, W>::pop(OutputIt first, size_type count) -> size_type {
+    if (0u == count) {
+        return 0u;
+    }
+
+    m_not_empty.wait([this] { return 0u != readable(); });
+
+    return try_pop(first, count);
+}
+
+template<typename T, typename W> bool
+spsc_ring<T, W>::empty() const noexcept {
+    return 0u == size();
+}
+
+template<typename T, typename W> auto
+spsc_ring<T, W>::size() const noexcept -> size_type {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return m_head.load(std::memory_order_acquire) - tail;
+}
+
+template<typename T, typename W> auto
+spsc_ring<T, W>::capacity() const noexcept -> size_type {
+    return m_buffer.size();
+}
+
+} /* namespace logic */
+
+#endif /* LOGIC_SPSC_RING_HPP */
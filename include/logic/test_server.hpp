@@ -0,0 +1,75 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_TEST_SERVER_HPP
+#define LOGIC_TEST_SERVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace logic {
+
+/* Class: logic::test_server
+ *
+ * Runs many UVM tests from a single elaborated executable. Enabled by the
+ * +logic_tests=<test>[,<test>...] command line argument. After the DUT and
+ * virtual interfaces are constructed, <run> forks a child process for every
+ * test and seed pair, at most +logic_jobs=<n> at once. Every child selects
+ * its test, sets the seed and trace_filename, runs the test and writes its
+ * output to <test>_<seed>.log. Other output files get the same <test>_<seed>
+ * suffix, see <logic::get_output_filename>. Results are combined into a
+ * single exit status and +logic_report=<filename> writes JUnit XML report,
+ * or JSON report for a .json file extension.
+ *
+ * Seeds are given by +logic_seeds=<seed>[,<first>:<last>...], by default
+ * every test runs once with a random seed. Verilated models must be single
+ * threaded, model threads are not duplicated by fork().
+ */
+class test_server {
+public:
+    using test_type = std::function<bool()>;
+
+    test_server(int argc, char* argv[]);
+
+    bool enabled() const noexcept;
+
+    int run(const test_type& test);
+private:
+    struct job {
+        std::string test;
+        std::uint32_t seed;
+        std::string name;
+        int status;
+        bool passed;
+        double time;
+    };
+
+    void write_junit(const std::vector<job>& jobs) const;
+
+    void write_json(const std::vector<job>& jobs) const;
+
+    std::string m_executable{};
+    std::vector<std::string> m_tests{};
+    std::vector<std::uint32_t> m_seeds{};
+    std::size_t m_jobs{0};
+    std::string m_report{};
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_TEST_SERVER_HPP */
@@ -18,6 +18,7 @@
 
 #include "trace_systemc.hpp"
 #include "trace_verilated.hpp"
+#include "trace_verilated_fst.hpp"
 
 #include <cstddef>
 #include <limits>
@@ -29,8 +30,9 @@ template<typename T, typename enable = void>
 class trace final : public trace_systemc {
 public:
     explicit trace(T& module, const std::string& filename = {},
-            std::size_t level = std::numeric_limits<std::size_t>::max()) :
-        trace_systemc{module, filename, level}
+            std::size_t level = std::numeric_limits<std::size_t>::max(),
+            const trace_filter& filter = {}) :
+        trace_systemc{module, filename, level, filter}
     { }
 
     trace(trace&&) = delete;
@@ -46,11 +48,34 @@ public:
 
 template<typename T>
 class trace<T, typename std::enable_if<has_verilated_vcd_trace_method<T>::value
-    >::type> final : public trace_verilated {
+    && !has_verilated_fst_trace_method<T>::value>::type> final :
+    public trace_verilated {
 public:
     explicit trace(T& module, const std::string& filename = {},
-            std::size_t level = std::numeric_limits<std::size_t>::max()) :
-        trace_verilated{module, filename, level}
+            std::size_t level = std::numeric_limits<std::size_t>::max(),
+            const trace_filter& filter = {}) :
+        trace_verilated{module, filename, level, filter}
+    { }
+
+    trace(trace&&) = delete;
+
+    trace(const trace&) = delete;
+
+    trace& operator=(trace&&) = delete;
+
+    trace& operator=(const trace&) = delete;
+
+    ~trace() override = default;
+};
+
+template<typename T>
+class trace<T, typename std::enable_if<has_verilated_fst_trace_method<T>::value
+    >::type> final : public trace_verilated_fst {
+public:
+    explicit trace(T& module, const std::string& filename = {},
+            std::size_t level = std::numeric_limits<std::size_t>::max(),
+            const trace_filter& filter = {}) :
+        trace_verilated_fst{module, filename, level, filter}
     { }
 
     trace(trace&&) = delete;
@@ -16,10 +16,33 @@
 #ifndef LOGIC_TRACE_BASE_HPP
 #define LOGIC_TRACE_BASE_HPP
 
+#include <systemc>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
 namespace logic {
 
 class trace_base {
 public:
+    enum format_t {
+        VCD,
+        FST
+    };
+
+    static void set_format(format_t format) noexcept;
+
+    static void set_format(const std::string& name);
+
+    static void set_start(const std::string& time);
+
+    static void set_stop(const std::string& time);
+
+    static void set_ring(const std::string& time);
+
+    static void trigger();
+
     trace_base(trace_base&&) = delete;
 
     trace_base(const trace_base&) = delete;
@@ -28,9 +51,36 @@ public:
 
     trace_base& operator=(const trace_base&) = delete;
 protected:
-    trace_base() = default;
+    trace_base();
 
     virtual ~trace_base();
+
+    static format_t get_format(const std::string& filename) noexcept;
+
+    static std::string get_stem(const std::string& filename);
+
+    static bool is_windowed() noexcept;
+
+    void run(const std::string& stem);
+
+    virtual const char* extension() const noexcept;
+
+    virtual void open(const std::string& filename);
+
+    virtual void close();
+private:
+    void control();
+
+    void open_segment();
+
+    void close_segment();
+
+    bool m_opened{false};
+    bool m_triggered{false};
+    std::size_t m_index{0};
+    std::string m_stem{};
+    std::vector<std::string> m_segments{};
+    sc_core::sc_event m_trigger{};
 };
 
 } /* namespace logic */
@@ -0,0 +1,77 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOGIC_TRACE_FILTER_HPP
+#define LOGIC_TRACE_FILTER_HPP
+
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace logic {
+
+/* Class: logic::trace_filter
+ *
+ * Selects traced scopes by hierarchical names. Patterns are globs with '*'
+ * and '?' wildcards or, when prefixed with "re:", ECMAScript regular
+ * expressions. A scope is selected when it or one of its parents matches
+ * an include pattern (or no include patterns are given) and neither it nor
+ * any of its parents matches an exclude pattern.
+ *
+ * Patterns can also be provided with the comma separated "trace_include"
+ * and "trace_exclude" string values in the uvm_config_db.
+ */
+class trace_filter {
+public:
+    trace_filter() = default;
+
+    explicit trace_filter(const std::vector<std::string>& includes,
+            const std::vector<std::string>& excludes = {});
+
+    trace_filter& include(const std::string& pattern);
+
+    trace_filter& exclude(const std::string& pattern);
+
+    trace_filter& configure();
+
+    bool empty() const noexcept;
+
+    bool exact() const noexcept;
+
+    bool selected(const std::string& name) const;
+
+    bool excluded(const std::string& name) const;
+
+    std::vector<std::string> scopes() const;
+private:
+    struct pattern {
+        std::string text;
+        bool is_regex;
+        std::regex regex;
+
+        bool match(const std::string& name) const;
+    };
+
+    static pattern compile(const std::string& text);
+
+    static bool match(const std::vector<pattern>& patterns,
+            const std::string& name);
+
+    std::vector<pattern> m_includes{};
+    std::vector<pattern> m_excludes{};
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_TRACE_FILTER_HPP */
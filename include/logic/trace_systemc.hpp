@@ -17,6 +17,7 @@
 #define LOGIC_TRACE_SYSTEMC_HPP
 
 #include "trace_base.hpp"
+#include "trace_filter.hpp"
 
 #include <systemc>
 
@@ -36,7 +37,8 @@ public:
     trace_systemc& operator=(const trace_systemc&) = delete;
 protected:
     trace_systemc(const sc_core::sc_object& object,
-            const std::string& filename, std::size_t level);
+            const std::string& filename, std::size_t level,
+            const trace_filter& filter);
 
     ~trace_systemc() override;
 private:
@@ -17,6 +17,7 @@
 #define LOGIC_TRACE_VERILATED_HPP
 
 #include "trace_base.hpp"
+#include "trace_filter.hpp"
 
 #include <systemc>
 
@@ -32,10 +33,10 @@ template<typename T>
 class has_verilated_vcd_trace_method {
 private:
     template<typename C>
-    static std::true_type test(void(C::*)(VerilatedVcdC*, int, int));
+    static std::true_type check(void(C::*)(VerilatedVcdC*, int, int));
 
     template<typename C>
-    static decltype(test(&C::trace)) test(std::nullptr_t);
+    static decltype(check(&C::trace)) test(std::nullptr_t);
 
     template<typename C>
     static std::false_type test(...);
@@ -58,13 +59,18 @@ public:
 protected:
     template<typename T>
     trace_verilated(T& object, const std::string& filename,
-            std::size_t level);
+            std::size_t level, const trace_filter& filter);
 
     ~trace_verilated() override;
-private:
-    trace_verilated(const std::string& name, const std::string& filename);
 
-    void open();
+    const char* extension() const noexcept override;
+
+    void open(const std::string& filename) override;
+
+    void close() override;
+private:
+    trace_verilated(const std::string& name, const std::string& filename,
+            const trace_filter& filter);
 
     VerilatedVcdC* get(VerilatedVcdSc* verilated_vcd) const noexcept;
 
@@ -74,11 +80,11 @@ private:
 
 template<typename T>
 trace_verilated::trace_verilated(T& object, const std::string& filename,
-        std::size_t level) :
-    trace_verilated{object.basename(), filename}
+        std::size_t level, const trace_filter& filter) :
+    trace_verilated{object.basename(), filename, filter}
 {
     object.trace(get(m_trace_file), int(level));
-    open();
+    run(m_filename);
 }
 
 } /* namespace logic */
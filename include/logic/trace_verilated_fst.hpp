@@ -0,0 +1,93 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_TRACE_VERILATED_FST_HPP
+#define LOGIC_TRACE_VERILATED_FST_HPP
+
+#include "trace_base.hpp"
+#include "trace_filter.hpp"
+
+#include <systemc>
+
+#include <cstddef>
+#include <string>
+
+class VerilatedFstC;
+class VerilatedFstSc;
+
+namespace logic {
+
+template<typename T>
+class has_verilated_fst_trace_method {
+private:
+    template<typename C>
+    static std::true_type check(void(C::*)(VerilatedFstC*, int, int));
+
+    template<typename C>
+    static decltype(check(&C::trace)) test(std::nullptr_t);
+
+    template<typename C>
+    static std::false_type test(...);
+public:
+    has_verilated_fst_trace_method() = delete;
+
+    using type = decltype(test<T>(nullptr));
+    static const bool value = type::value;
+};
+
+class trace_verilated_fst : public trace_base {
+public:
+    trace_verilated_fst(const trace_verilated_fst&) = delete;
+
+    trace_verilated_fst& operator=(const trace_verilated_fst&) = delete;
+
+    trace_verilated_fst(trace_verilated_fst&&) = delete;
+
+    trace_verilated_fst& operator=(trace_verilated_fst&&) = delete;
+protected:
+    template<typename T>
+    trace_verilated_fst(T& object, const std::string& filename,
+            std::size_t level, const trace_filter& filter);
+
+    ~trace_verilated_fst() override;
+
+    const char* extension() const noexcept override;
+
+    void open(const std::string& filename) override;
+
+    void close() override;
+private:
+    trace_verilated_fst(const std::string& name, const std::string& filename,
+            const trace_filter& filter);
+
+    VerilatedFstC* get(VerilatedFstSc* verilated_fst) const noexcept;
+
+    VerilatedFstSc* m_trace_file{nullptr};
+    std::string m_filename{};
+};
+
+template<typename T>
+trace_verilated_fst::trace_verilated_fst(T& object,
+        const std::string& filename, std::size_t level,
+        const trace_filter& filter) :
+    trace_verilated_fst{object.basename(), filename, filter}
+{
+    object.trace(get(m_trace_file), int(level));
+    run(m_filename);
+}
+
+} /* namespace logic */
+
+#endif /* LOGIC_TRACE_VERILATED_FST_HPP */
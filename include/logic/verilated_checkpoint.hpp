@@ -0,0 +1,65 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_VERILATED_CHECKPOINT_HPP
+#define LOGIC_VERILATED_CHECKPOINT_HPP
+
+#include "checkpoint.hpp"
+
+#include <verilated_save.h>
+
+#include <string>
+
+namespace logic {
+
+/* Class: logic::verilated_checkpoint
+ *
+ * Registers Verilated model in <logic::checkpoint>. Model must be verilated
+ * with the --savable option, see SAVABLE option of add_hdl_systemc().
+ */
+template<typename Model>
+class verilated_checkpoint {
+public:
+    verilated_checkpoint(const std::string& name, Model& model) {
+        checkpoint::add_model(name,
+            [&model] (const std::string& filename) {
+                VerilatedSave os;
+                os.open(filename.c_str());
+                os << model;
+                os.close();
+            },
+            [&model] (const std::string& filename) {
+                VerilatedRestore os;
+                os.open(filename.c_str());
+                os >> model;
+                os.close();
+            }
+        );
+    }
+
+    verilated_checkpoint(verilated_checkpoint&&) = delete;
+
+    verilated_checkpoint(const verilated_checkpoint&) = delete;
+
+    verilated_checkpoint& operator=(verilated_checkpoint&&) = delete;
+
+    verilated_checkpoint& operator=(const verilated_checkpoint&) = delete;
+
+    ~verilated_checkpoint() = default;
+};
+
+} /* namespace logic */
+
+#endif /* LOGIC_VERILATED_CHECKPOINT_HPP */
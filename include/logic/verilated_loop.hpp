@@ -0,0 +1,127 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_VERILATED_LOOP_HPP
+#define LOGIC_VERILATED_LOOP_HPP
+
+#include <systemc>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace logic {
+
+/* Class: logic::verilated_loop
+ *
+ * Clocks Verilated C++ model (verilator --cc) directly from a single SystemC
+ * thread, without sc_clock and sc_signal ports. Every clock cycle it
+ * evaluates the rising edge, wakes up all processes waiting in
+ * aclk_posedge() of connected virtual interfaces, applies values written by
+ * them after half of a clock period and samples model outputs for the next
+ * cycle.
+ *
+ * The aclk signal is still toggled for reset agents and other SystemC
+ * processes, areset_n is read from SystemC reset signal.
+ */
+template<typename Model, typename Port = std::uint8_t>
+class verilated_loop : public sc_core::sc_module {
+public:
+    sc_core::sc_signal<bool> aclk{"aclk"};
+    sc_core::sc_in<bool> areset_n{"areset_n"};
+
+    verilated_loop(const sc_core::sc_module_name& module_name, Model& model,
+            Port& model_aclk, Port& model_areset_n,
+            const sc_core::sc_time& period = {10, sc_core::SC_NS}) :
+        sc_core::sc_module{module_name},
+        m_model(model),
+        m_aclk(model_aclk),
+        m_areset_n_port(model_areset_n),
+        m_period{period}
+    {
+        sc_core::sc_spawn(sc_bind(&verilated_loop::run, this),
+                sc_core::sc_gen_unique_name("run"));
+    }
+
+    template<typename Bus>
+    void add(Bus& bus) {
+        bus.connect(m_posedge, m_areset_n, m_period);
+
+        m_apply.emplace_back([&bus] () { bus.apply(); });
+        m_sample.emplace_back([&bus] () { bus.sample(); });
+    }
+
+    const sc_core::sc_event& posedge_event() const noexcept {
+        return m_posedge;
+    }
+
+    verilated_loop(verilated_loop&&) = delete;
+
+    verilated_loop(const verilated_loop&) = delete;
+
+    verilated_loop& operator=(verilated_loop&&) = delete;
+
+    verilated_loop& operator=(const verilated_loop&) = delete;
+
+    ~verilated_loop() override;
+private:
+    void run() {
+        const auto half_period = m_period / 2.0;
+
+        while (true) {
+            m_aclk = Port(1);
+            m_model.eval();
+
+            aclk.write(true);
+            m_posedge.notify(sc_core::SC_ZERO_TIME);
+
+            sc_core::wait(half_period);
+
+            m_areset_n = areset_n.read();
+            m_areset_n_port = Port(m_areset_n);
+
+            for (const auto& apply : m_apply) {
+                apply();
+            }
+
+            m_aclk = Port(0);
+            m_model.eval();
+
+            for (const auto& sample : m_sample) {
+                sample();
+            }
+
+            aclk.write(false);
+
+            sc_core::wait(half_period);
+        }
+    }
+
+    Model& m_model;
+    Port& m_aclk;
+    Port& m_areset_n_port;
+    bool m_areset_n{false};
+    sc_core::sc_time m_period;
+    sc_core::sc_event m_posedge{};
+    std::vector<std::function<void()>> m_apply{};
+    std::vector<std::function<void()>> m_sample{};
+};
+
+template<typename Model, typename Port>
+verilated_loop<Model, Port>::~verilated_loop() = default;
+
+} /* namespace logic */
+
+#endif /* LOGIC_VERILATED_LOOP_HPP */
@@ -0,0 +1,76 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AXI4_STREAM_BINARY_HPP
+#define AXI4_STREAM_BINARY_HPP
+
+#include "logic/bitstream.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+namespace binary {
+
+inline std::size_t bytes(std::size_t bits) noexcept {
+    return (bits + 7u) / 8u;
+}
+
+template<typename T>
+inline void store(std::vector<std::uint8_t>& buffer, T value) {
+    for (std::size_t i = 0u; i < sizeof(T); ++i) {
+        buffer.push_back(std::uint8_t(value >> (8u * i)));
+    }
+}
+
+template<typename T>
+inline T load(const std::uint8_t*& position) noexcept {
+    T value{0};
+
+    for (std::size_t i = 0u; i < sizeof(T); ++i) {
+        value = T(value | (T(position[i]) << (8u * i)));
+    }
+
+    position += sizeof(T);
+    return value;
+}
+
+inline void store(std::vector<std::uint8_t>& buffer,
+        const bitstream& bits, std::size_t width) {
+    const auto size = bytes(width);
+    const auto count = std::min(size, bytes(bits.size()));
+    auto data = static_cast<const std::uint8_t*>(bits.data());
+
+    buffer.insert(buffer.end(), data, data + count);
+    buffer.insert(buffer.end(), size - count, 0);
+}
+
+inline void load(const std::uint8_t*& position, bitstream& bits,
+        std::size_t width) {
+    bits.resize(width);
+    bits.assign(static_cast<const void*>(position), width);
+    position += bytes(width);
+}
+
+} /* namespace binary */
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* AXI4_STREAM_BINARY_HPP */
@@ -18,54 +18,54 @@
 using logic::axi4::stream::bus_if_base;
 
 bus_if_base::bus_if_base(const sc_core::sc_module_name& module_name) :
-    sc_core::sc_module{module_name},
-    aclk{"aclk"},
-    areset_n{"areset_n"},
-    tvalid{"tvalid"},
-    tready{"tready"},
-    tlast{"tlast"}
+    sc_core::sc_module{module_name}
 { }
 
-void bus_if_base::trace(sc_core::sc_trace_file* trace_file) const {
-    if (trace_file != nullptr) {
-        sc_core::sc_trace(trace_file, aclk, aclk.name());
-        sc_core::sc_trace(trace_file, areset_n, areset_n.name());
-        sc_core::sc_trace(trace_file, tvalid, tvalid.name());
-        sc_core::sc_trace(trace_file, tready, tready.name());
-        sc_core::sc_trace(trace_file, tlast, tlast.name());
-    }
-}
+auto bus_if_base::aclk_posedge(std::size_t cycles) -> std::size_t {
+    const bool tready = get_tready();
+    std::size_t count = 0;
 
-void bus_if_base::aclk_posedge() {
-    sc_core::wait(aclk.posedge_event());
-}
+    while (count < cycles) {
+        aclk_posedge();
+        ++count;
 
-bool bus_if_base::get_areset_n() const {
-    return areset_n.read();
-}
+        const bool changed = !m_tready_driven && (get_tready() != tready);
 
-void bus_if_base::set_tvalid(bool value) {
-    tvalid.write(value);
-}
+        if (!get_areset_n() || changed) {
+            break;
+        }
+    }
 
-bool bus_if_base::get_tvalid() const {
-    return tvalid.read();
+    return count;
 }
 
-void bus_if_base::set_tready(bool value) {
-    tready.write(value);
-}
+/*
+ * Timed wait ends a quarter of a clock period after the (cycles - 1) rising
+ * edge, away from the rising edge and from the falling edge where
+ * <logic::verilated_loop> applies driven values. Rising edge is waited for
+ * as usual, so processes are resumed in the same delta cycle as with
+ * aclk_posedge(). Stop event resumes waiting earlier.
+ */
+auto bus_if_base::aclk_skip(std::size_t cycles, const sc_core::sc_time& period,
+        const sc_core::sc_time& posedge,
+        const sc_core::sc_event_or_list& stop) -> std::size_t {
+    const auto ticks = period.value();
+    const auto now = sc_core::sc_time_stamp().value();
 
-bool bus_if_base::get_tready() const {
-    return tready.read();
-}
+    if ((cycles < 2) || (0 == ticks) || (now < posedge.value())) {
+        return bus_if_base::aclk_posedge(cycles);
+    }
 
-void bus_if_base::set_tlast(bool value) {
-    tlast.write(value);
-}
+    const auto phase = (now - posedge.value()) % ticks;
+    const auto next = now + (ticks - phase);
+    const auto target = next + ((cycles - 1) * ticks);
+
+    sc_core::wait(sc_core::sc_time::from_value(target - now - (3 * ticks / 4)),
+            stop);
+
+    aclk_posedge();
 
-bool bus_if_base::get_tlast() const {
-    return tlast.read();
+    return std::size_t((sc_core::sc_time_stamp().value() - next) / ticks) + 1;
 }
 
 bus_if_base::~bus_if_base() = default;
@@ -0,0 +1,158 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/compare_pool.hpp"
+
+#include <utility>
+
+using logic::axi4::stream::compare_pool;
+
+static constexpr std::size_t STOP{std::numeric_limits<std::size_t>::max()};
+
+compare_pool::worker::worker(std::size_t depth, const packet_diff& value) :
+    slots(depth),
+    jobs{depth + 1u},
+    done{depth},
+    diff{value}
+{ }
+
+compare_pool::compare_pool(std::size_t workers, std::size_t depth,
+        const packet_diff& diff) :
+    m_workers{},
+    m_depth{(0 != depth) ? depth : 1},
+    m_submitted{0},
+    m_collected{0}
+{
+    if (0 == workers) {
+        workers = 1;
+    }
+
+    for (std::size_t i = 0u; i < workers; ++i) {
+        m_workers.emplace_back(new worker{m_depth, diff});
+    }
+
+    for (auto& value : m_workers) {
+        auto current = value.get();
+        value->thread = std::thread{[this, current] { run(*current); }};
+    }
+}
+
+compare_pool::~compare_pool() {
+    for (auto& value : m_workers) {
+        value->jobs.push(STOP);
+    }
+
+    for (auto& value : m_workers) {
+        if (value->thread.joinable()) {
+            value->thread.join();
+        }
+    }
+}
+
+compare_pool::job* compare_pool::acquire() noexcept {
+    auto& current = *m_workers[m_submitted % m_workers.size()];
+
+    if ((current.submitted - current.collected) >= m_depth) {
+        return nullptr;
+    }
+
+    return &current.slots[current.submitted % m_depth];
+}
+
+void compare_pool::submit() {
+    auto& current = *m_workers[m_submitted % m_workers.size()];
+
+    /* Never full, slot was acquired so there is room for its index */
+    current.jobs.try_push(current.submitted % m_depth);
+
+    ++current.submitted;
+    ++m_submitted;
+}
+
+bool compare_pool::submit(packet&& expected, packet&& actual) {
+    auto slot = acquire();
+
+    if (nullptr == slot) {
+        return false;
+    }
+
+    std::swap(slot->expected, expected);
+    std::swap(slot->actual, actual);
+
+    submit();
+
+    return true;
+}
+
+std::size_t compare_pool::collect(bool wait, const callback& handler,
+        std::size_t limit) {
+    std::size_t collected = 0;
+
+    while ((m_collected < m_submitted) && (collected < limit)) {
+        auto& current = *m_workers[m_collected % m_workers.size()];
+        std::size_t index;
+
+        if (wait) {
+            current.done.pop(index);
+        }
+        else if (!current.done.try_pop(index)) {
+            break;
+        }
+
+        handler(current.slots[index]);
+
+        ++current.collected;
+        ++m_collected;
+        ++collected;
+    }
+
+    return collected;
+}
+
+std::size_t compare_pool::pending() const noexcept {
+    return m_submitted - m_collected;
+}
+
+static void release(logic::axi4::stream::packet& value) {
+    decltype(value.tuser){}.swap(value.tuser);
+    decltype(value.tdata){}.swap(value.tdata);
+    decltype(value.timestamps){}.swap(value.timestamps);
+}
+
+void compare_pool::run(worker& value) {
+    while (true) {
+        std::size_t index;
+
+        value.jobs.pop(index);
+
+        if (STOP == index) {
+            break;
+        }
+
+        auto& slot = value.slots[index];
+
+        slot.equal = value.diff.compare(slot.expected, slot.actual);
+        slot.report = slot.equal ? std::string{} : value.diff.report();
+
+        /* Matching packets are not needed for reporting */
+        if (slot.equal) {
+            release(slot.expected);
+            release(slot.actual);
+        }
+
+        /* Never full, there are no more jobs in flight than slots */
+        value.done.try_push(index);
+    }
+}
@@ -0,0 +1,231 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/coverage.hpp"
+
+#include "logic/axi4/stream/bus_if_base.hpp"
+
+#include <sstream>
+
+using logic::axi4::stream::coverage;
+
+constexpr std::size_t coverage::LOG2_BINS;
+constexpr std::size_t coverage::PAIR_BITS;
+
+coverage::coverage() {
+    m_bins[PACKET_LENGTH].resize(LOG2_BINS);
+    m_bins[BEAT_COUNT].resize(LOG2_BINS);
+    m_bins[GAP].resize(LOG2_BINS);
+    m_bins[BACKPRESSURE].resize(LOG2_BINS);
+    m_bins[TID_TDEST].resize(std::size_t(1) << (2u * PAIR_BITS));
+}
+
+coverage::~coverage() = default;
+
+void coverage::sample(const bus_if_base& vif) {
+    if (!vif.get_areset_n()) {
+        m_length = 0;
+        m_beats = 0;
+        m_gap = 0;
+        m_backpressure = 0;
+        m_in_packet = false;
+        return;
+    }
+
+    const bool tvalid = vif.get_tvalid();
+    const bool tready = vif.get_tready();
+
+    if (tvalid && !tready) {
+        ++m_backpressure;
+    }
+    else {
+        end_backpressure();
+    }
+
+    if (!(tvalid && tready)) {
+        if (m_in_packet) {
+            ++m_gap;
+        }
+        return;
+    }
+
+    if (m_in_packet) {
+        hit(GAP, bin(m_gap));
+    }
+
+    std::size_t kept = 0;
+
+    for (std::size_t i = 0u; i < vif.size(); ++i) {
+        if (vif.get_tkeep(i)) {
+            ++kept;
+        }
+    }
+
+    m_length += kept;
+    ++m_beats;
+    m_gap = 0;
+    m_in_packet = true;
+
+    if (vif.get_tlast()) {
+        constexpr auto mask = (std::uintmax_t(1) << PAIR_BITS) - 1u;
+
+        const auto pair = ((vif.get_tid().value(PAIR_BITS) & mask) <<
+                PAIR_BITS) | (vif.get_tdest().value(PAIR_BITS) & mask);
+
+        if (m_bins[LAST_TKEEP].size() <= vif.size()) {
+            m_bins[LAST_TKEEP].resize(vif.size() + 1u);
+        }
+
+        hit(PACKET_LENGTH, bin(m_length));
+        hit(BEAT_COUNT, bin(m_beats));
+        hit(LAST_TKEEP, kept);
+        hit(TID_TDEST, std::size_t(pair));
+
+        m_length = 0;
+        m_beats = 0;
+        m_in_packet = false;
+    }
+}
+
+void coverage::require(group_t group, std::size_t first, std::size_t last,
+        std::uint64_t at_least) {
+    goal value;
+
+    value.group = group;
+    value.first = first;
+    value.last = last;
+    value.at_least = at_least;
+
+    m_goals.push_back(value);
+}
+
+bool coverage::covered() const noexcept {
+    for (const auto& value : m_goals) {
+        for (auto i = value.first; i <= value.last; ++i) {
+            if (hits(value.group, i) < value.at_least) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+double coverage::ratio() const noexcept {
+    std::size_t required = 0;
+    std::size_t met = 0;
+
+    for (const auto& value : m_goals) {
+        for (auto i = value.first; i <= value.last; ++i) {
+            ++required;
+
+            if (hits(value.group, i) >= value.at_least) {
+                ++met;
+            }
+        }
+    }
+
+    return (0 == required) ? 1.0 : (double(met) / double(required));
+}
+
+auto coverage::hits(group_t group, std::size_t index) const noexcept ->
+        std::uint64_t {
+    return ((group < GROUPS) && (index < m_bins[group].size())) ?
+        m_bins[group][index] : 0;
+}
+
+auto coverage::bins(group_t group) const noexcept -> std::size_t {
+    return (group < GROUPS) ? m_bins[group].size() : 0;
+}
+
+std::string coverage::report() const {
+    std::ostringstream stream;
+
+    stream << "Coverage " << unsigned(100.0 * ratio()) << "%";
+
+    for (std::size_t group = 0u; group < GROUPS; ++group) {
+        stream << "\n  " << to_string(group_t(group)) << ":";
+
+        for (std::size_t i = 0u; i < m_bins[group].size(); ++i) {
+            if (0 != m_bins[group][i]) {
+                stream << " [" << i << "]=" << m_bins[group][i];
+            }
+        }
+    }
+
+    return stream.str();
+}
+
+void coverage::clear() noexcept {
+    for (auto& group : m_bins) {
+        for (auto& counter : group) {
+            counter = 0;
+        }
+    }
+
+    m_length = 0;
+    m_beats = 0;
+    m_gap = 0;
+    m_backpressure = 0;
+    m_in_packet = false;
+}
+
+auto coverage::bin(std::uint64_t value) noexcept -> std::size_t {
+    std::size_t index = 0;
+
+    while ((0 != value) && (index < (LOG2_BINS - 1u))) {
+        value >>= 1u;
+        ++index;
+    }
+
+    return index;
+}
+
+const char* coverage::to_string(group_t group) noexcept {
+    switch (group) {
+    case PACKET_LENGTH:
+        return "packet length";
+    case BEAT_COUNT:
+        return "beat count";
+    case LAST_TKEEP:
+        return "last tkeep";
+    case GAP:
+        return "gap";
+    case BACKPRESSURE:
+        return "backpressure";
+    case TID_TDEST:
+        return "tid tdest";
+    case GROUPS:
+    default:
+        break;
+    }
+
+    return "unknown";
+}
+
+void coverage::hit(group_t group, std::size_t index) noexcept {
+    auto& counters = m_bins[group];
+
+    if (index < counters.size()) {
+        ++counters[index];
+    }
+}
+
+void coverage::end_backpressure() noexcept {
+    if (0 != m_backpressure) {
+        hit(BACKPRESSURE, bin(m_backpressure));
+        m_backpressure = 0;
+    }
+}
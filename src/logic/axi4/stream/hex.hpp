@@ -0,0 +1,46 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AXI4_STREAM_HEX_HPP
+#define AXI4_STREAM_HEX_HPP
+
+#include "logic/hex.hpp"
+#include "logic/axi4/stream/tdata_byte.hpp"
+
+namespace logic {
+namespace axi4 {
+namespace stream {
+namespace hex {
+
+using logic::hex::append;
+using logic::hex::to_string;
+
+inline const char* type_name(tdata_byte::type_t type) noexcept {
+    static const char* const names[] = {
+        "data",
+        "null",
+        "position",
+        "reserved"
+    };
+
+    return names[type];
+}
+
+} /* namespace hex */
+} /* namespace stream */
+} /* namespace axi4 */
+} /* namespace logic */
+
+#endif /* AXI4_STREAM_HEX_HPP */
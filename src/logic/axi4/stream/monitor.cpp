@@ -15,13 +15,20 @@
 
 #include "logic/axi4/stream/monitor.hpp"
 
+#include "logic/axi4/stream/beat.hpp"
 #include "logic/axi4/stream/packet.hpp"
 #include "logic/axi4/stream/bus_if_base.hpp"
+#include "logic/axi4/stream/coverage.hpp"
+#include "logic/axi4/stream/protocol_checker.hpp"
+#include "logic/profile.hpp"
 
 #include <map>
+#include <string>
 #include <utility>
 
 using logic::axi4::stream::monitor;
+using logic::axi4::stream::tdata_byte;
+using logic::axi4::stream::bus_if_base;
 
 using packet_type = logic::axi4::stream::packet;
 using packet_id_type = std::pair<logic::bitstream, logic::bitstream>;
@@ -45,6 +52,28 @@ static auto get_packet(packets_type& packets,
     return *packet;
 }
 
+static auto get_tdata_byte(const bus_if_base& vif, std::size_t index)
+        -> tdata_byte {
+    const bool tkeep = vif.get_tkeep(index);
+    const bool tstrb = vif.get_tstrb(index);
+    tdata_byte::type_t type;
+
+    if (tkeep && tstrb) {
+        type = tdata_byte::DATA_BYTE;
+    }
+    else if (tkeep && !tstrb) {
+        type = tdata_byte::POSITION_BYTE;
+    }
+    else if (!tkeep && tstrb) {
+        type = tdata_byte::RESERVED;
+    }
+    else {
+        type = tdata_byte::NULL_BYTE;
+    }
+
+    return tdata_byte{vif.get_tdata(index), type};
+}
+
 monitor::monitor() :
     monitor{"monitor"}
 { }
@@ -52,9 +81,13 @@ monitor::monitor() :
 monitor::monitor(const uvm::uvm_component_name& component_name) :
     uvm::uvm_monitor{component_name},
     analysis_port{"analysis_port"},
+    beat_analysis_port{"beat_analysis_port"},
     m_vif{nullptr},
+    m_coverage{nullptr},
+    m_coverage_owned{},
     m_checks_enable{false},
-    m_coverage_enable{false}
+    m_coverage_enable{false},
+    m_streaming{false}
 { }
 
 monitor::~monitor() = default;
@@ -73,18 +106,72 @@ void monitor::build_phase(uvm::uvm_phase& phase) {
     uvm::uvm_config_db<bool>::get(this, "*", "checks_enable", m_checks_enable);
     uvm::uvm_config_db<bool>::get(this, "*", "coverage_enable",
             m_coverage_enable);
+
+    uvm::uvm_config_db<bool>::get(this, "*", "streaming", m_streaming);
+
+    if (m_coverage_enable) {
+        uvm::uvm_config_db<coverage*>::get(this, "*", "coverage", m_coverage);
+
+        if (nullptr == m_coverage) {
+            m_coverage_owned.reset(new coverage);
+            m_coverage = m_coverage_owned.get();
+        }
+    }
 }
 
 void monitor::run_phase(uvm::uvm_phase& /* phase */) {
     UVM_INFO(get_name(), "Run phase", uvm::UVM_FULL);
 
     packets_type packets;
+    beat transfer;
+    protocol_checker checker{*m_vif};
+    std::size_t violations{0};
     const auto bus_size = m_vif->size() ? m_vif->size() : 1;
 
     while (true) {
+        LOGIC_PROFILE_SCOPE(timer, "run_phase");
+
+        if (m_checks_enable) {
+            const auto violation = checker.check();
+
+            if (protocol_checker::NONE != violation) {
+                std::string message{protocol_checker::to_string(violation)};
+
+                message += " at " + sc_core::sc_time_stamp().to_string();
+
+                if (0 == violations++) {
+                    UVM_ERROR(get_name(), "Protocol violation: " + message);
+                }
+                else {
+                    UVM_INFO(get_name(), "Protocol violation: " + message,
+                            uvm::UVM_HIGH);
+                }
+            }
+        }
+
+        if (m_coverage_enable) {
+            m_coverage->sample(*m_vif);
+        }
+
         if (!m_vif->get_areset_n()) {
             packets.clear();
         }
+        else if (m_streaming && m_vif->get_tvalid() && m_vif->get_tready()) {
+            transfer.tid = m_vif->get_tid();
+            transfer.tdest = m_vif->get_tdest();
+            transfer.tuser = m_vif->get_tuser();
+            transfer.tlast = m_vif->get_tlast();
+            transfer.timestamp = sc_core::sc_time_stamp();
+            transfer.tdata.resize(bus_size);
+
+            LOGIC_PROFILE_COUNT("transfers", 1);
+
+            for (auto i = 0u; i < bus_size; ++i) {
+                transfer.tdata[i] = get_tdata_byte(*m_vif, i);
+            }
+
+            beat_analysis_port.write(transfer);
+        }
         else if (m_vif->get_tvalid() && m_vif->get_tready()) {
             auto packet_id = packet_id_type{
                 m_vif->get_tid(),
@@ -96,23 +183,10 @@ void monitor::run_phase(uvm::uvm_phase& /* phase */) {
             packet.tuser.emplace_back(m_vif->get_tuser());
             packet.bus_size = bus_size;
 
-            for (auto i = 0u; i < bus_size; ++i) {
-                tdata_byte::type_t tdata_byte_type;
+            LOGIC_PROFILE_COUNT("transfers", 1);
 
-                if (m_vif->get_tkeep(i) && m_vif->get_tstrb(i)) {
-                    tdata_byte_type = tdata_byte::DATA_BYTE;
-                }
-                else if (m_vif->get_tkeep(i) && !m_vif->get_tstrb(i)) {
-                    tdata_byte_type = tdata_byte::POSITION_BYTE;
-                }
-                else if (!m_vif->get_tkeep(i) && m_vif->get_tstrb(i)) {
-                    tdata_byte_type = tdata_byte::RESERVED;
-                }
-                else {
-                    tdata_byte_type = tdata_byte::NULL_BYTE;
-                }
-
-                packet.tdata.emplace_back(m_vif->get_tdata(i), tdata_byte_type);
+            for (auto i = 0u; i < bus_size; ++i) {
+                packet.tdata.push_back(get_tdata_byte(*m_vif, i));
             }
 
             if (m_vif->get_tlast()) {
@@ -120,6 +194,17 @@ void monitor::run_phase(uvm::uvm_phase& /* phase */) {
                 packets.erase(packet_id);
             }
         }
+
+        LOGIC_PROFILE_STOP(timer);
+
         m_vif->aclk_posedge();
     }
 }
+
+void monitor::report_phase(uvm::uvm_phase& phase) {
+    uvm::uvm_monitor::report_phase(phase);
+
+    if (m_coverage_enable) {
+        UVM_INFO(get_name(), m_coverage->report(), uvm::UVM_LOW);
+    }
+}
@@ -0,0 +1,293 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/packet_diff.hpp"
+#include "logic/axi4/stream/packet.hpp"
+
+#include "hex.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using logic::axi4::stream::packet;
+using logic::axi4::stream::packet_diff;
+using logic::axi4::stream::hex::append;
+using logic::axi4::stream::hex::to_string;
+using logic::axi4::stream::hex::type_name;
+
+static constexpr std::size_t WORD{sizeof(std::uint64_t)};
+
+static void pack(const packet& value, std::vector<std::uint8_t>& data,
+        std::vector<std::uint8_t>& types) {
+    const std::size_t size = value.tdata.size();
+
+    data.resize(size);
+    types.resize(size);
+
+    for (std::size_t i = 0u; i < size; ++i) {
+        data[i] = value.tdata[i].data();
+        types[i] = std::uint8_t(value.tdata[i].type());
+    }
+}
+
+packet_diff::packet_diff(std::size_t max_differences, std::size_t context) :
+    m_max_differences{max_differences},
+    m_context{context},
+    m_bus_size{1},
+    m_expected_size{0},
+    m_actual_size{0},
+    m_tdata_mismatches{0},
+    m_tuser_mismatches{0},
+    m_tid_mismatch{false},
+    m_tdest_mismatch{false},
+    m_tuser_size_mismatch{false},
+    m_tid{},
+    m_tdest{},
+    m_tuser{},
+    m_differences{},
+    m_expected_data{},
+    m_expected_types{},
+    m_actual_data{},
+    m_actual_types{}
+{ }
+
+packet_diff::~packet_diff() = default;
+
+auto packet_diff::mismatch(const std::uint8_t* lhs, const std::uint8_t* rhs,
+        std::size_t size) noexcept -> std::size_t {
+    std::size_t index = 0u;
+
+    for (; (index + WORD) <= size; index += WORD) {
+        std::uint64_t lhs_word;
+        std::uint64_t rhs_word;
+
+        std::memcpy(&lhs_word, lhs + index, WORD);
+        std::memcpy(&rhs_word, rhs + index, WORD);
+
+        if (lhs_word != rhs_word) {
+            break;
+        }
+    }
+
+    for (; index < size; ++index) {
+        if (lhs[index] != rhs[index]) {
+            break;
+        }
+    }
+
+    return index;
+}
+
+bool packet_diff::compare(const packet& expected, const packet& actual) {
+    m_bus_size = (0u != expected.bus_size) ? expected.bus_size : 1u;
+    m_tid_mismatch = (expected.tid != actual.tid);
+    m_tdest_mismatch = (expected.tdest != actual.tdest);
+
+    m_tid = m_tid_mismatch ? ("expected " + to_string(expected.tid) +
+            " actual " + to_string(actual.tid)) : std::string{};
+
+    m_tdest = m_tdest_mismatch ? ("expected " + to_string(expected.tdest) +
+            " actual " + to_string(actual.tdest)) : std::string{};
+
+    compare_tuser(expected, actual);
+    compare_tdata(expected, actual);
+
+    return equal();
+}
+
+void packet_diff::compare_tuser(const packet& expected,
+        const packet& actual) {
+    const auto size = std::min(expected.tuser.size(), actual.tuser.size());
+
+    m_tuser.clear();
+    m_tuser_mismatches = 0u;
+    m_tuser_size_mismatch = (expected.tuser.size() != actual.tuser.size());
+
+    for (std::size_t i = 0u; i < size; ++i) {
+        if (expected.tuser[i] != actual.tuser[i]) {
+            if (m_tuser.size() < m_max_differences) {
+                m_tuser.push_back(i);
+            }
+            ++m_tuser_mismatches;
+        }
+    }
+}
+
+void packet_diff::compare_tdata(const packet& expected,
+        const packet& actual) {
+    pack(expected, m_expected_data, m_expected_types);
+    pack(actual, m_actual_data, m_actual_types);
+
+    m_expected_size = m_expected_data.size();
+    m_actual_size = m_actual_data.size();
+    m_tdata_mismatches = 0u;
+    m_differences.clear();
+
+    const auto size = std::min(m_expected_size, m_actual_size);
+
+    auto next_data = mismatch(m_expected_data.data(), m_actual_data.data(),
+            size);
+
+    auto next_type = mismatch(m_expected_types.data(),
+            m_actual_types.data(), size);
+
+    while (true) {
+        const auto offset = std::min(next_data, next_type);
+
+        if (offset >= size) {
+            break;
+        }
+
+        if (m_differences.size() < m_max_differences) {
+            m_differences.push_back({
+                offset,
+                expected.tdata[offset],
+                actual.tdata[offset]
+            });
+        }
+
+        ++m_tdata_mismatches;
+
+        const auto position = offset + 1u;
+
+        if (next_data < position) {
+            next_data = position + mismatch(
+                    m_expected_data.data() + position,
+                    m_actual_data.data() + position, size - position);
+        }
+
+        if (next_type < position) {
+            next_type = position + mismatch(
+                    m_expected_types.data() + position,
+                    m_actual_types.data() + position, size - position);
+        }
+    }
+
+    m_tdata_mismatches += std::max(m_expected_size, m_actual_size) - size;
+}
+
+bool packet_diff::equal() const noexcept {
+    return !m_tid_mismatch && !m_tdest_mismatch && !m_tuser_size_mismatch &&
+        (0u == m_tuser_mismatches) && (0u == m_tdata_mismatches);
+}
+
+auto packet_diff::differences() const noexcept
+        -> const std::vector<difference>& {
+    return m_differences;
+}
+
+auto packet_diff::tdata_mismatches() const noexcept -> std::size_t {
+    return m_tdata_mismatches;
+}
+
+auto packet_diff::tuser_mismatches() const noexcept -> std::size_t {
+    return m_tuser_mismatches;
+}
+
+void packet_diff::dump(std::string& output, const char* name,
+        const std::vector<std::uint8_t>& data,
+        const std::vector<std::uint8_t>& types) const {
+    const auto center = m_differences.empty() ?
+        std::min(m_expected_size, m_actual_size) : m_differences[0].offset;
+    const auto begin = (center > m_context) ? (center - m_context) : 0u;
+    const auto end = std::min(data.size(), center + m_context + 1u);
+
+    output += "    ";
+    output += name;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        output.push_back((i == center) ? '>' : ' ');
+
+        if (0u == types[i]) {
+            append(output, data[i]);
+        }
+        else {
+            output += "--";
+        }
+    }
+
+    output.push_back('\n');
+}
+
+std::string packet_diff::report() const {
+    std::string output;
+
+    if (equal()) {
+        return output;
+    }
+
+    output += "Packet mismatch\n";
+
+    if (m_tid_mismatch) {
+        output += "  tid: " + m_tid + "\n";
+    }
+
+    if (m_tdest_mismatch) {
+        output += "  tdest: " + m_tdest + "\n";
+    }
+
+    if (m_tuser_size_mismatch) {
+        output += "  tuser: transfers count differs\n";
+    }
+
+    if (0u != m_tuser_mismatches) {
+        output += "  tuser: " + std::to_string(m_tuser_mismatches) +
+            " mismatching transfers, first at";
+
+        for (const auto transfer : m_tuser) {
+            output += " " + std::to_string(transfer);
+        }
+
+        output.push_back('\n');
+    }
+
+    if (m_expected_size != m_actual_size) {
+        output += "  tdata: size expected " +
+            std::to_string(m_expected_size) + " actual " +
+            std::to_string(m_actual_size) + "\n";
+    }
+
+    if (0u == m_tdata_mismatches) {
+        return output;
+    }
+
+    output += "  tdata: " + std::to_string(m_tdata_mismatches) +
+        " mismatching bytes\n";
+
+    for (const auto& diff : m_differences) {
+        output += "    offset " + std::to_string(diff.offset) +
+            " transfer " + std::to_string(diff.offset / m_bus_size) +
+            " byte " + std::to_string(diff.offset % m_bus_size) +
+            ": expected 0x";
+        append(output, diff.expected.data());
+        output += " actual 0x";
+        append(output, diff.actual.data());
+
+        if (diff.expected.type() != diff.actual.type()) {
+            output += " type expected ";
+            output += type_name(diff.expected.type());
+            output += " actual ";
+            output += type_name(diff.actual.type());
+        }
+
+        output.push_back('\n');
+    }
+
+    output += "  context:\n";
+    dump(output, "expected:", m_expected_data, m_expected_types);
+    dump(output, "actual:  ", m_actual_data, m_actual_types);
+
+    return output;
+}
@@ -0,0 +1,357 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/packet_writer.hpp"
+#include "logic/axi4/stream/packet.hpp"
+#include "logic/printer/json.hpp"
+#include "logic/hex.hpp"
+
+#include "binary.hpp"
+
+#include <algorithm>
+
+using logic::axi4::stream::packet;
+using logic::axi4::stream::packet_writer;
+using logic::axi4::stream::tdata_byte;
+using logic::axi4::stream::binary::bytes;
+
+static const char BASE64_DIGITS[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static std::uint64_t picoseconds(const sc_core::sc_time& value) {
+    return std::uint64_t((value.to_seconds() * 1e12) + 0.5);
+}
+
+static bool is_typed(const packet& value) {
+    return std::any_of(value.tdata.cbegin(), value.tdata.cend(),
+        [] (const tdata_byte& tdata) {
+            return !tdata.is_data_byte();
+        }
+    );
+}
+
+packet_writer::packet_writer(std::ostream& output, format_t format,
+        encoding_t encoding) :
+    m_output(output),
+    m_format{format},
+    m_encoding{encoding},
+    m_buffer{},
+    m_bytes{}
+{ }
+
+packet_writer::~packet_writer() = default;
+
+bool packet_writer::to_format(const std::string& name,
+        format_t& format) noexcept {
+    bool valid = true;
+
+    if ("json" == name) {
+        format = JSON;
+    }
+    else if ("ndjson" == name) {
+        format = NDJSON;
+    }
+    else if ("msgpack" == name) {
+        format = MSGPACK;
+    }
+    else {
+        valid = false;
+    }
+
+    return valid;
+}
+
+bool packet_writer::to_encoding(const std::string& name,
+        encoding_t& encoding) noexcept {
+    bool valid = true;
+
+    if ("base64" == name) {
+        encoding = BASE64;
+    }
+    else if ("hex" == name) {
+        encoding = HEX;
+    }
+    else {
+        valid = false;
+    }
+
+    return valid;
+}
+
+void packet_writer::write(const packet& value) {
+    switch (m_format) {
+    case NDJSON:
+        write_ndjson(value);
+        break;
+    case MSGPACK:
+        write_msgpack(value);
+        break;
+    case JSON:
+    default:
+        print_json(value);
+        break;
+    }
+}
+
+void packet_writer::flush() {
+    m_output.flush();
+}
+
+void packet_writer::print_json(const packet& value) {
+    logic::printer::json json_printer{m_output};
+    value.sprint(&json_printer);
+}
+
+void packet_writer::encode(const std::uint8_t* data, std::size_t size) {
+    if (HEX == m_encoding) {
+        for (std::size_t i = 0u; i < size; ++i) {
+            logic::hex::append(m_buffer, data[i]);
+        }
+        return;
+    }
+
+    std::size_t i = 0u;
+
+    for (; (i + 3u) <= size; i += 3u) {
+        const auto bits = (unsigned(data[i]) << 16) |
+            (unsigned(data[i + 1]) << 8) | unsigned(data[i + 2]);
+
+        m_buffer.push_back(BASE64_DIGITS[(bits >> 18) & 0x3F]);
+        m_buffer.push_back(BASE64_DIGITS[(bits >> 12) & 0x3F]);
+        m_buffer.push_back(BASE64_DIGITS[(bits >> 6) & 0x3F]);
+        m_buffer.push_back(BASE64_DIGITS[bits & 0x3F]);
+    }
+
+    if (i < size) {
+        const bool pair = ((i + 1u) < size);
+        const auto bits = (unsigned(data[i]) << 16) |
+            (pair ? (unsigned(data[i + 1]) << 8) : 0u);
+
+        m_buffer.push_back(BASE64_DIGITS[(bits >> 18) & 0x3F]);
+        m_buffer.push_back(BASE64_DIGITS[(bits >> 12) & 0x3F]);
+        m_buffer.push_back(pair ? BASE64_DIGITS[(bits >> 6) & 0x3F] : '=');
+        m_buffer.push_back('=');
+    }
+}
+
+void packet_writer::hex(const bitstream& bits) {
+    m_buffer.push_back('"');
+    logic::hex::append(m_buffer, bits);
+    m_buffer.push_back('"');
+}
+
+void packet_writer::write_ndjson(const packet& value) {
+    m_buffer.clear();
+
+    m_buffer.append("{\"name\":\"");
+    m_buffer.append(value.get_name());
+    m_buffer.append("\",\"tid\":");
+    hex(value.tid);
+    m_buffer.append(",\"tdest\":");
+    hex(value.tdest);
+    m_buffer.append(",\"bus_size\":");
+    m_buffer.append(std::to_string(value.bus_size));
+
+    m_buffer.append(",\"timestamps\":[");
+
+    for (std::size_t i = 0u; i < value.timestamps.size(); ++i) {
+        if (0u != i) {
+            m_buffer.push_back(',');
+        }
+        m_buffer.append(std::to_string(picoseconds(value.timestamps[i])));
+    }
+
+    m_buffer.append("],\"tuser\":[");
+
+    for (std::size_t i = 0u; i < value.tuser.size(); ++i) {
+        if (0u != i) {
+            m_buffer.push_back(',');
+        }
+        hex(value.tuser[i]);
+    }
+
+    m_buffer.append("],\"encoding\":\"");
+    m_buffer.append((HEX == m_encoding) ? "hex" : "base64");
+    m_buffer.append("\",\"tdata\":\"");
+
+    m_bytes.resize(value.tdata.size());
+
+    std::transform(value.tdata.cbegin(), value.tdata.cend(), m_bytes.begin(),
+        [] (const tdata_byte& tdata) {
+            return tdata.data();
+        }
+    );
+
+    encode(m_bytes.data(), m_bytes.size());
+    m_buffer.push_back('"');
+
+    if (is_typed(value)) {
+        std::transform(value.tdata.cbegin(), value.tdata.cend(),
+            m_bytes.begin(),
+            [] (const tdata_byte& tdata) {
+                return std::uint8_t(tdata.type());
+            }
+        );
+
+        m_buffer.append(",\"types\":\"");
+        encode(m_bytes.data(), m_bytes.size());
+        m_buffer.push_back('"');
+    }
+
+    m_buffer.append("}\n");
+
+    m_output.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+}
+
+void packet_writer::msgpack_size(std::uint8_t type, std::size_t size,
+        std::size_t count) {
+    m_buffer.push_back(char(type));
+
+    for (std::size_t i = count; i > 0u; --i) {
+        m_buffer.push_back(char(std::uint8_t(size >> (8u * (i - 1u)))));
+    }
+}
+
+void packet_writer::msgpack_unsigned(std::uint64_t value) {
+    if (value < 0x80) {
+        m_buffer.push_back(char(value));
+        return;
+    }
+
+    std::size_t count = 8u;
+    std::uint8_t type = 0xCF;
+
+    if (value <= 0xFF) {
+        count = 1u;
+        type = 0xCC;
+    }
+    else if (value <= 0xFFFF) {
+        count = 2u;
+        type = 0xCD;
+    }
+    else if (value <= 0xFFFFFFFF) {
+        count = 4u;
+        type = 0xCE;
+    }
+
+    m_buffer.push_back(char(type));
+
+    for (std::size_t i = count; i > 0u; --i) {
+        m_buffer.push_back(char(std::uint8_t(value >> (8u * (i - 1u)))));
+    }
+}
+
+void packet_writer::msgpack_string(const std::string& value) {
+    if (value.size() < 32u) {
+        m_buffer.push_back(char(0xA0 | value.size()));
+    }
+    else if (value.size() <= 0xFFFF) {
+        msgpack_size(0xDA, value.size(), 2u);
+    }
+    else {
+        msgpack_size(0xDB, value.size(), 4u);
+    }
+
+    m_buffer.append(value);
+}
+
+void packet_writer::msgpack_binary(const std::uint8_t* data,
+        std::size_t size) {
+    if (size <= 0xFF) {
+        m_buffer.push_back(char(0xC4));
+        m_buffer.push_back(char(size));
+    }
+    else if (size <= 0xFFFF) {
+        msgpack_size(0xC5, size, 2u);
+    }
+    else {
+        msgpack_size(0xC6, size, 4u);
+    }
+
+    m_buffer.append(reinterpret_cast<const char*>(data), size);
+}
+
+void packet_writer::msgpack_array(std::size_t size) {
+    if (size < 16u) {
+        m_buffer.push_back(char(0x90 | size));
+    }
+    else if (size <= 0xFFFF) {
+        msgpack_size(0xDC, size, 2u);
+    }
+    else {
+        msgpack_size(0xDD, size, 4u);
+    }
+}
+
+void packet_writer::write_msgpack(const packet& value) {
+    const bool typed = is_typed(value);
+
+    m_buffer.clear();
+    m_buffer.push_back(char(0x80 | (typed ? 8 : 7)));
+
+    msgpack_string("name");
+    msgpack_string(value.get_name());
+
+    msgpack_string("tid");
+    msgpack_binary(static_cast<const std::uint8_t*>(value.tid.data()),
+            bytes(value.tid.size()));
+
+    msgpack_string("tdest");
+    msgpack_binary(static_cast<const std::uint8_t*>(value.tdest.data()),
+            bytes(value.tdest.size()));
+
+    msgpack_string("bus_size");
+    msgpack_unsigned(value.bus_size);
+
+    msgpack_string("timestamps");
+    msgpack_array(value.timestamps.size());
+
+    for (const auto& timestamp : value.timestamps) {
+        msgpack_unsigned(picoseconds(timestamp));
+    }
+
+    msgpack_string("tuser");
+    msgpack_array(value.tuser.size());
+
+    for (const auto& tuser : value.tuser) {
+        msgpack_binary(static_cast<const std::uint8_t*>(tuser.data()),
+                bytes(tuser.size()));
+    }
+
+    m_bytes.resize(value.tdata.size());
+
+    std::transform(value.tdata.cbegin(), value.tdata.cend(), m_bytes.begin(),
+        [] (const tdata_byte& tdata) {
+            return tdata.data();
+        }
+    );
+
+    msgpack_string("tdata");
+    msgpack_binary(m_bytes.data(), m_bytes.size());
+
+    if (typed) {
+        std::transform(value.tdata.cbegin(), value.tdata.cend(),
+            m_bytes.begin(),
+            [] (const tdata_byte& tdata) {
+                return std::uint8_t(tdata.type());
+            }
+        );
+
+        msgpack_string("types");
+        msgpack_binary(m_bytes.data(), m_bytes.size());
+    }
+
+    m_output.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+}
@@ -0,0 +1,151 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/protocol_checker.hpp"
+
+#include "logic/axi4/stream/bus_if_base.hpp"
+
+using logic::axi4::stream::protocol_checker;
+
+protocol_checker::protocol_checker(const bus_if_base& vif) :
+    m_vif(vif)
+{
+    const std::size_t bytes = m_vif.size();
+
+    m_previous.tdata.resize((bytes + 7u) / 8u);
+    m_previous.tkeep.resize((bytes + 63u) / 64u);
+    m_previous.tstrb.resize((bytes + 63u) / 64u);
+}
+
+protocol_checker::~protocol_checker() = default;
+
+void protocol_checker::reset() noexcept {
+    m_stalled = false;
+}
+
+auto protocol_checker::check() -> violation_t {
+    if (!m_vif.get_areset_n()) {
+        reset();
+        return NONE;
+    }
+
+    const bool tvalid = m_vif.get_tvalid();
+    const bool tready = m_vif.get_tready();
+    const bool stalled = m_stalled;
+
+    m_stalled = tvalid && !tready;
+
+    if (!tvalid) {
+        return stalled ? TVALID_DEASSERTED : NONE;
+    }
+
+    auto violation = NONE;
+
+    for (std::size_t i = 0u; i < m_vif.size(); ++i) {
+        if (m_vif.get_tstrb(i) && !m_vif.get_tkeep(i)) {
+            violation = RESERVED_BYTE;
+            break;
+        }
+    }
+
+    if (stalled) {
+        if (payload_changed()) {
+            violation = PAYLOAD_CHANGED;
+        }
+        else if (sideband_changed()) {
+            violation = SIDEBAND_CHANGED;
+        }
+    }
+
+    /* Stored beat is refreshed only when stall starts or beat has changed */
+    if (m_stalled && (!stalled || (NONE != violation))) {
+        sample();
+    }
+
+    return violation;
+}
+
+bool protocol_checker::payload_changed() const {
+    for (std::size_t i = 0u; i < m_vif.size(); ++i) {
+        const auto bit = std::uint64_t(1) << (i % 64u);
+        const auto tdata = std::uint8_t(m_previous.tdata[i / 8u] >>
+                (8u * (i % 8u)));
+        const bool tkeep = (0 != (m_previous.tkeep[i / 64u] & bit));
+        const bool tstrb = (0 != (m_previous.tstrb[i / 64u] & bit));
+
+        if ((m_vif.get_tdata(i) != tdata) || (m_vif.get_tkeep(i) != tkeep) ||
+                (m_vif.get_tstrb(i) != tstrb)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool protocol_checker::sideband_changed() const {
+    return (m_vif.get_tlast() != m_previous.tlast) ||
+        !(m_vif.get_tid() == m_previous.tid) ||
+        !(m_vif.get_tdest() == m_previous.tdest) ||
+        !(m_vif.get_tuser() == m_previous.tuser);
+}
+
+void protocol_checker::sample() {
+    for (auto& word : m_previous.tdata) {
+        word = 0;
+    }
+
+    for (std::size_t i = 0u; i < m_previous.tkeep.size(); ++i) {
+        m_previous.tkeep[i] = 0;
+        m_previous.tstrb[i] = 0;
+    }
+
+    for (std::size_t i = 0u; i < m_vif.size(); ++i) {
+        const auto bit = std::uint64_t(1) << (i % 64u);
+
+        m_previous.tdata[i / 8u] |= std::uint64_t(m_vif.get_tdata(i)) <<
+            (8u * (i % 8u));
+
+        if (m_vif.get_tkeep(i)) {
+            m_previous.tkeep[i / 64u] |= bit;
+        }
+
+        if (m_vif.get_tstrb(i)) {
+            m_previous.tstrb[i / 64u] |= bit;
+        }
+    }
+
+    m_previous.tlast = m_vif.get_tlast();
+    m_previous.tid = m_vif.get_tid();
+    m_previous.tdest = m_vif.get_tdest();
+    m_previous.tuser = m_vif.get_tuser();
+}
+
+const char* protocol_checker::to_string(violation_t violation) noexcept {
+    switch (violation) {
+    case TVALID_DEASSERTED:
+        return "tvalid deasserted before handshake";
+    case PAYLOAD_CHANGED:
+        return "tdata, tkeep or tstrb changed while stalled";
+    case SIDEBAND_CHANGED:
+        return "tlast, tid, tdest or tuser changed while stalled";
+    case RESERVED_BYTE:
+        return "reserved tkeep and tstrb combination";
+    case NONE:
+    default:
+        break;
+    }
+
+    return "no violation";
+}
@@ -0,0 +1,404 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/recorder.hpp"
+#include "logic/output_file.hpp"
+
+#include "binary.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+using logic::axi4::stream::packet;
+using logic::axi4::stream::recorder;
+using logic::axi4::stream::record_reader;
+using logic::axi4::stream::tdata_byte;
+using logic::axi4::stream::binary::bytes;
+using logic::axi4::stream::binary::load;
+using logic::axi4::stream::binary::store;
+
+/*
+ * File layout, all values are stored in little-endian byte order:
+ *
+ * header:
+ *  [0:7]   magic "LGCTLOG\0"
+ *  [8:11]  version
+ *  [12:15] reserved
+ *  [16:23] time resolution in femtoseconds
+ *  [24:31] number of records, zero when recording was not finished
+ *
+ * record:
+ *  [0:7]   record size in bytes including this field
+ *  [8:11]  tid width in bits
+ *  [12:15] tdest width in bits
+ *  [16:19] tuser width in bits
+ *  [20:23] number of tuser transfers
+ *  [24:31] number of tdata bytes
+ *  [32:39] bus size in bytes
+ *  [40:47] number of timestamps
+ *  [48]    flags: tdata byte types present
+ *  [49:55] reserved
+ *  [56:]   timestamps, tid, tdest, tuser transfers, tdata bytes,
+ *          tdata byte types
+ */
+
+static constexpr std::array<std::uint8_t, 8> MAGIC{{
+    'L', 'G', 'C', 'T', 'L', 'O', 'G', '\0'
+}};
+
+static constexpr std::uint32_t VERSION{1};
+static constexpr std::size_t HEADER_SIZE{32};
+static constexpr std::size_t RECORDS_OFFSET{24};
+static constexpr std::size_t RECORD_HEADER_SIZE{56};
+static constexpr std::size_t DEFAULT_BUFFER_SIZE{8 * 1024 * 1024};
+
+static constexpr std::uint8_t FLAG_TDATA_TYPES{0x01};
+
+static std::uint64_t time_resolution() {
+    return std::uint64_t(
+        (sc_core::sc_get_time_resolution().to_seconds() * 1e15) + 0.5);
+}
+
+recorder::recorder() :
+    recorder{"recorder"}
+{ }
+
+recorder::recorder(const uvm::uvm_component_name& component_name) :
+    uvm::uvm_subscriber<packet>{component_name},
+    m_filename{},
+    m_buffer_size{DEFAULT_BUFFER_SIZE},
+    m_records{0},
+    m_file{},
+    m_front{},
+    m_back{},
+    m_mutex{},
+    m_condition{},
+    m_thread{},
+    m_pending{false},
+    m_done{false}
+{ }
+
+recorder::~recorder() {
+    close();
+}
+
+void recorder::build_phase(uvm::uvm_phase& phase) {
+    uvm::uvm_subscriber<packet>::build_phase(phase);
+
+    UVM_INFO(get_name(), "Build phase", uvm::UVM_FULL);
+
+    int buffer_size{0};
+
+    uvm::uvm_config_db<std::string>::get(this, "", "filename", m_filename);
+
+    m_filename = logic::get_output_filename(m_filename);
+
+    if (uvm::uvm_config_db<int>::get(this, "", "buffer_size", buffer_size) &&
+            (buffer_size > 0)) {
+        m_buffer_size = std::size_t(buffer_size);
+    }
+
+    if (!m_filename.empty()) {
+        open();
+    }
+}
+
+void recorder::final_phase(uvm::uvm_phase& phase) {
+    uvm::uvm_subscriber<packet>::final_phase(phase);
+
+    UVM_INFO(get_name(), "Final phase", uvm::UVM_FULL);
+
+    if (m_thread.joinable()) {
+        close();
+
+        if (!m_file) {
+            UVM_ERROR(get_name(), "Cannot write transaction log " +
+                    m_filename + "!");
+        }
+    }
+}
+
+auto recorder::records() const noexcept -> std::size_t {
+    return m_records;
+}
+
+void recorder::open() {
+    m_file.open(m_filename, std::ios::binary | std::ios::trunc);
+
+    if (!m_file) {
+        UVM_FATAL(get_name(), "Cannot create transaction log " +
+                m_filename + "! Simulation aborted!");
+    }
+
+    m_front.assign(MAGIC.cbegin(), MAGIC.cend());
+    store<std::uint32_t>(m_front, VERSION);
+    store<std::uint32_t>(m_front, 0);
+    store<std::uint64_t>(m_front, time_resolution());
+    store<std::uint64_t>(m_front, 0);
+
+    m_front.reserve(m_buffer_size + (m_buffer_size / 8));
+    m_back.reserve(m_front.capacity());
+
+    m_thread = std::thread{&recorder::writer, this};
+}
+
+void recorder::close() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    if (!m_front.empty()) {
+        flush();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_condition.wait(lock, [this] () { return !m_pending; });
+        m_done = true;
+    }
+
+    m_condition.notify_all();
+    m_thread.join();
+
+    m_front.clear();
+    store<std::uint64_t>(m_front, m_records);
+
+    m_file.seekp(std::streamoff(RECORDS_OFFSET));
+    m_file.write(reinterpret_cast<const char*>(m_front.data()),
+            std::streamsize(m_front.size()));
+    m_file.close();
+}
+
+void recorder::flush() {
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_condition.wait(lock, [this] () { return !m_pending; });
+        m_front.swap(m_back);
+        m_pending = true;
+    }
+
+    m_condition.notify_all();
+}
+
+void recorder::writer() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+
+    while (true) {
+        m_condition.wait(lock, [this] () { return m_pending || m_done; });
+
+        if (!m_pending) {
+            break;
+        }
+
+        lock.unlock();
+
+        m_file.write(reinterpret_cast<const char*>(m_back.data()),
+                std::streamsize(m_back.size()));
+        m_back.clear();
+
+        lock.lock();
+        m_pending = false;
+        m_condition.notify_all();
+    }
+}
+
+void recorder::write(const packet& value) {
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    const bool typed = std::any_of(value.tdata.cbegin(), value.tdata.cend(),
+        [] (const tdata_byte& tdata) {
+            return !tdata.is_data_byte();
+        }
+    );
+
+    const std::size_t tuser_width = value.tuser.empty() ?
+        0u : value.tuser[0].size();
+
+    const std::size_t offset = m_front.size();
+
+    store<std::uint64_t>(m_front, 0);
+    store<std::uint32_t>(m_front, std::uint32_t(value.tid.size()));
+    store<std::uint32_t>(m_front, std::uint32_t(value.tdest.size()));
+    store<std::uint32_t>(m_front, std::uint32_t(tuser_width));
+    store<std::uint32_t>(m_front, std::uint32_t(value.tuser.size()));
+    store<std::uint64_t>(m_front, value.tdata.size());
+    store<std::uint64_t>(m_front, value.bus_size);
+    store<std::uint64_t>(m_front, value.timestamps.size());
+    store<std::uint8_t>(m_front, std::uint8_t(typed ? FLAG_TDATA_TYPES : 0));
+    store<std::uint8_t>(m_front, 0);
+    store<std::uint16_t>(m_front, 0);
+    store<std::uint32_t>(m_front, 0);
+
+    for (const auto& timestamp : value.timestamps) {
+        store<std::uint64_t>(m_front, timestamp.value());
+    }
+
+    store(m_front, value.tid, value.tid.size());
+    store(m_front, value.tdest, value.tdest.size());
+
+    for (const auto& tuser : value.tuser) {
+        store(m_front, tuser, tuser_width);
+    }
+
+    for (const auto& tdata : value.tdata) {
+        m_front.push_back(tdata.data());
+    }
+
+    if (typed) {
+        for (const auto& tdata : value.tdata) {
+            m_front.push_back(std::uint8_t(tdata.type()));
+        }
+    }
+
+    const auto size = std::uint64_t(m_front.size() - offset);
+
+    for (std::size_t i = 0u; i < sizeof(size); ++i) {
+        m_front[offset + i] = std::uint8_t(size >> (8u * i));
+    }
+
+    ++m_records;
+
+    if (m_front.size() >= m_buffer_size) {
+        flush();
+    }
+}
+
+record_reader::record_reader(const std::string& filename) :
+    m_file{filename, std::ios::binary},
+    m_buffer(HEADER_SIZE),
+    m_resolution{0},
+    m_records{0},
+    m_filename{filename}
+{
+    if (!m_file) {
+        throw std::runtime_error("Cannot open transaction log " + filename);
+    }
+
+    m_file.read(reinterpret_cast<char*>(m_buffer.data()),
+            std::streamsize(m_buffer.size()));
+
+    const std::uint8_t* position = m_buffer.data();
+
+    const bool valid = m_file &&
+        std::equal(MAGIC.cbegin(), MAGIC.cend(), position);
+    position += MAGIC.size();
+
+    const auto version = load<std::uint32_t>(position);
+    position += sizeof(std::uint32_t);
+
+    m_resolution = load<std::uint64_t>(position);
+    m_records = std::size_t(load<std::uint64_t>(position));
+
+    if (!valid || (VERSION != version)) {
+        throw std::runtime_error("Invalid transaction log " + filename);
+    }
+}
+
+record_reader::~record_reader() = default;
+
+auto record_reader::records() const noexcept -> std::size_t {
+    return m_records;
+}
+
+bool record_reader::read(packet& value) {
+    m_buffer.resize(RECORD_HEADER_SIZE);
+
+    m_file.read(reinterpret_cast<char*>(m_buffer.data()),
+            std::streamsize(m_buffer.size()));
+
+    if (0 == m_file.gcount()) {
+        return false;
+    }
+
+    if (std::size_t(m_file.gcount()) != RECORD_HEADER_SIZE) {
+        throw std::runtime_error("Truncated transaction log " + m_filename);
+    }
+
+    const std::uint8_t* position = m_buffer.data();
+
+    const auto size = std::size_t(load<std::uint64_t>(position));
+    const std::size_t tid_width = load<std::uint32_t>(position);
+    const std::size_t tdest_width = load<std::uint32_t>(position);
+    const std::size_t tuser_width = load<std::uint32_t>(position);
+    const std::size_t tuser_count = load<std::uint32_t>(position);
+    const auto tdata_count = std::size_t(load<std::uint64_t>(position));
+    const auto bus_size = std::size_t(load<std::uint64_t>(position));
+    const auto timestamps = std::size_t(load<std::uint64_t>(position));
+    const auto flags = load<std::uint8_t>(position);
+
+    const bool typed = (0 != (flags & FLAG_TDATA_TYPES));
+
+    const std::size_t expected = RECORD_HEADER_SIZE +
+        (timestamps * sizeof(std::uint64_t)) + bytes(tid_width) +
+        bytes(tdest_width) + (tuser_count * bytes(tuser_width)) +
+        (typed ? (2u * tdata_count) : tdata_count);
+
+    if (size != expected) {
+        throw std::runtime_error("Corrupted transaction log " + m_filename);
+    }
+
+    m_buffer.resize(size);
+
+    m_file.read(reinterpret_cast<char*>(m_buffer.data() + RECORD_HEADER_SIZE),
+            std::streamsize(size - RECORD_HEADER_SIZE));
+
+    if (!m_file) {
+        throw std::runtime_error("Truncated transaction log " + m_filename);
+    }
+
+    position = m_buffer.data() + RECORD_HEADER_SIZE;
+
+    value.bus_size = bus_size;
+    value.timestamps.resize(timestamps);
+
+    for (auto& timestamp : value.timestamps) {
+        timestamp = sc_core::sc_time{
+            double(load<std::uint64_t>(position) * m_resolution),
+            sc_core::SC_FS
+        };
+    }
+
+    load(position, value.tid, tid_width);
+    load(position, value.tdest, tdest_width);
+
+    value.tuser.resize(tuser_count);
+
+    for (auto& tuser : value.tuser) {
+        load(position, tuser, tuser_width);
+    }
+
+    value.tdata.resize(tdata_count);
+
+    const auto types = position + tdata_count;
+
+    for (std::size_t i = 0u; i < tdata_count; ++i) {
+        auto tdata_type = tdata_byte::DATA_BYTE;
+
+        if (typed) {
+            if (types[i] > tdata_byte::RESERVED) {
+                throw std::runtime_error("Corrupted transaction log " +
+                        m_filename);
+            }
+            tdata_type = tdata_byte::type_t(types[i]);
+        }
+
+        value.tdata[i] = tdata_byte{position[i], tdata_type};
+    }
+
+    return true;
+}
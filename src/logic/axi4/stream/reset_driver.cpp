@@ -17,6 +17,9 @@
 
 #include "logic/axi4/stream/reset_if.hpp"
 #include "logic/axi4/stream/reset_sequence_item.hpp"
+#include "logic/checkpoint.hpp"
+
+#include <fstream>
 
 using logic::axi4::stream::reset_driver;
 
@@ -48,6 +51,19 @@ void reset_driver::build_phase(uvm::uvm_phase& phase) {
     if (m_item == nullptr) {
         UVM_FATAL(get_name(), "Cannot create reset sequence item!");
     }
+
+    logic::checkpoint::add(get_full_name(),
+        [this] (const std::string& filename) {
+            std::ofstream file{filename, std::ios::trunc};
+            file << m_vif->areset_n.read();
+        },
+        [this] (const std::string& filename) {
+            bool areset_n{false};
+            std::ifstream file{filename};
+            file >> areset_n;
+            m_vif->set_areset_n(areset_n);
+        }
+    );
 }
 
 void reset_driver::run_phase(uvm::uvm_phase& /* phase */) {
@@ -17,12 +17,19 @@
 
 #include "logic/axi4/stream/bus_if_base.hpp"
 #include "logic/axi4/stream/rx_sequence_item.hpp"
+#include "logic/checkpoint.hpp"
+#include "logic/profile.hpp"
+#include "logic/seed.hpp"
 
+#include <fstream>
 #include <utility>
 
 using logic::axi4::stream::rx_driver;
 using logic::axi4::stream::rx_sequence_item;
 
+/* Maximum number of clock cycles waited for at once without timeout */
+static constexpr std::size_t SKIP_MAX{1u << 16};
+
 rx_driver::rx_driver(const uvm::uvm_component_name& component_name) :
     uvm::uvm_driver<rx_sequence_item>{component_name},
     m_vif{nullptr},
@@ -34,8 +41,18 @@ void rx_driver::build_phase(uvm::uvm_phase& phase) {
     uvm::uvm_driver<rx_sequence_item>::build_phase(phase);
     UVM_INFO(get_name(), "Build phase", uvm::UVM_FULL);
 
-    std::random_device rd;
-    m_random_generator.seed(rd());
+    m_random_generator.seed(logic::get_seed(get_full_name()));
+
+    logic::checkpoint::add(get_full_name(),
+        [this] (const std::string& filename) {
+            std::ofstream file{filename, std::ios::trunc};
+            file << m_random_generator;
+        },
+        [this] (const std::string& filename) {
+            std::ifstream file{filename};
+            file >> m_random_generator;
+        }
+    );
 
     auto ok = uvm::uvm_config_db<bus_if_base*>::get(this, "*", "vif", m_vif);
 
@@ -79,19 +96,36 @@ void rx_driver::idle_transfer(const rx_sequence_item& item) {
     std::size_t timeout = item.timeout;
 
     while (0 != idle) {
-        if (m_vif->get_tready()) {
+        const bool tready = m_vif->get_tready();
+        std::size_t skip = 0;
+
+        if (tready) {
             --idle;
+            skip = idle;
         }
         else if (0 != item.timeout) {
             if (0 != timeout) {
                 --timeout;
+                skip = timeout;
             }
             else {
                 idle = 0;
                 UVM_ERROR(get_name(), "Timeout!");
             }
         }
-        m_vif->aclk_posedge();
+        else {
+            skip = SKIP_MAX;
+        }
+
+        /* Skipped cycles sampled the same tready, repeat their updates */
+        const std::size_t skipped = m_vif->aclk_posedge(1 + skip) - 1;
+
+        if (tready) {
+            idle -= skipped;
+        }
+        else if (0 != item.timeout) {
+            timeout -= skipped;
+        }
     }
 }
 
@@ -109,7 +143,12 @@ void rx_driver::data_transfer(const rx_sequence_item& item) {
     std::size_t index = 0;
 
     while (is_running && m_vif->get_areset_n()) {
-        if (m_vif->get_tready()) {
+        LOGIC_PROFILE_SCOPE(timer, "data_transfer");
+
+        const bool tready = m_vif->get_tready();
+        std::size_t skip = 0;
+
+        if (tready) {
             m_vif->set_tvalid(false);
 
             timeout = item.timeout;
@@ -163,6 +202,8 @@ void rx_driver::data_transfer(const rx_sequence_item& item) {
 
                 ++transfer;
 
+                LOGIC_PROFILE_COUNT("transfers", 1);
+
                 m_vif->set_tid(item.tid);
                 m_vif->set_tdest(item.tdest);
                 m_vif->set_tlast(index >= total_size);
@@ -170,18 +211,33 @@ void rx_driver::data_transfer(const rx_sequence_item& item) {
             }
             else {
                 --idle;
+                skip = idle;
             }
         }
         else if (0 != item.timeout) {
             if (0 != timeout) {
                 --timeout;
+                skip = timeout;
             }
             else {
                 is_running = false;
                 UVM_ERROR(get_name(), "Timeout!");
             }
         }
-        m_vif->aclk_posedge();
+        else {
+            skip = SKIP_MAX;
+        }
+
+        LOGIC_PROFILE_STOP(timer);
+
+        const std::size_t skipped = m_vif->aclk_posedge(1 + skip) - 1;
+
+        if (tready) {
+            idle -= skipped;
+        }
+        else if (0 != item.timeout) {
+            timeout -= skipped;
+        }
     }
 
     m_vif->set_tvalid(false);
@@ -14,6 +14,9 @@
  */
 
 #include "logic/axi4/stream/rx_sequence.hpp"
+#include "logic/axi4/stream/stimulus.hpp"
+
+#include <stdexcept>
 
 using logic::axi4::stream::rx_sequence;
 
@@ -23,7 +26,8 @@ rx_sequence::rx_sequence() :
 
 rx_sequence::rx_sequence(const std::string& name) :
     uvm::uvm_sequence<rx_sequence_item>{name},
-    items{}
+    items{},
+    stimulus{}
 { }
 
 rx_sequence::~rx_sequence() = default;
@@ -37,9 +41,14 @@ void rx_sequence::pre_body() {
 void rx_sequence::body() {
     UVM_INFO(get_name(), "Starting sequence", uvm::UVM_FULL);
 
-    for (auto& item : items) {
-        start_item(&item);
-        finish_item(&item);
+    if (stimulus.empty()) {
+        for (auto& item : items) {
+            start_item(&item);
+            finish_item(&item);
+        }
+    }
+    else {
+        stream_stimulus();
     }
 
     UVM_INFO(get_name(), "Finishing sequence", uvm::UVM_FULL);
@@ -50,3 +59,19 @@ void rx_sequence::post_body() {
         starting_phase->drop_objection(this);
     }
 }
+
+void rx_sequence::stream_stimulus() {
+    try {
+        stimulus_reader reader{stimulus};
+        rx_sequence_item item{"rx_sequence_item"};
+
+        while (reader.read(item)) {
+            start_item(&item);
+            finish_item(&item);
+        }
+    }
+    catch (const std::runtime_error& error) {
+        UVM_FATAL(get_name(), std::string{error.what()} +
+                "! Simulation aborted!");
+    }
+}
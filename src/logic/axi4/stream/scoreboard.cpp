@@ -14,7 +14,14 @@
  */
 
 #include "logic/axi4/stream/scoreboard.hpp"
-#include "logic/printer/json.hpp"
+#include "logic/axi4/stream/compare_pool.hpp"
+#include "logic/axi4/stream/packet_writer.hpp"
+#include "logic/output_file.hpp"
+#include "logic/profile.hpp"
+#include "logic/trace_base.hpp"
+
+#include <algorithm>
+#include <iostream>
 
 using logic::axi4::stream::scoreboard;
 
@@ -26,11 +33,23 @@ scoreboard::scoreboard(const uvm::uvm_component_name& component_name) :
     uvm::uvm_scoreboard{component_name},
     rx_analysis_export{"rx_analysis_export"},
     tx_analysis_export{"tx_analysis_export"},
+    rx_beat_analysis_export{"rx_beat_analysis_export"},
+    tx_beat_analysis_export{"tx_beat_analysis_export"},
     m_error{false},
     m_rx_fifo{"rx_fifo"},
     m_tx_fifo{"tx_fifo"},
     m_rx_packet{packet::type_id::create("rx", this)},
-    m_tx_packet{packet::type_id::create("tx", this)}
+    m_tx_packet{packet::type_id::create("tx", this)},
+    m_diff{},
+    m_streaming{false},
+    m_lookahead{65536},
+    m_rx_beat_fifo{"rx_beat_fifo"},
+    m_tx_beat_fifo{"tx_beat_fifo"},
+    m_beat{},
+    m_stream_diff{},
+    m_pool{nullptr},
+    m_mismatch_file{},
+    m_mismatch_writer{nullptr}
 {
     if (m_rx_packet == nullptr) {
         UVM_FATAL(get_name(), "Cannot create rx packet!");
@@ -51,29 +70,254 @@ bool scoreboard::failed() const noexcept {
 
 scoreboard::~scoreboard() = default;
 
+scoreboard::beat_fifo::beat_fifo(const char* name) :
+    tlm::tlm_analysis_fifo<beat>{name},
+    capacity{65536},
+    dropped{0}
+{ }
+
+void scoreboard::beat_fifo::write(const beat& value) {
+    if (std::size_t(used()) >= capacity) {
+        ++dropped;
+        return;
+    }
+
+    tlm::tlm_analysis_fifo<beat>::write(value);
+}
+
+void scoreboard::build_phase(uvm::uvm_phase& phase) {
+    uvm::uvm_scoreboard::build_phase(phase);
+
+    UVM_INFO(get_name(), "Build phase", uvm::UVM_FULL);
+
+    std::string format_name{"none"};
+    std::string encoding_name{"base64"};
+    std::string filename;
+    int differences{8};
+    int context{16};
+    int lookahead{int(m_lookahead)};
+    int workers{0};
+    int depth{16};
+
+    uvm::uvm_config_db<std::string>::get(this, "", "mismatch_format",
+            format_name);
+
+    uvm::uvm_config_db<std::string>::get(this, "", "mismatch_encoding",
+            encoding_name);
+
+    uvm::uvm_config_db<std::string>::get(this, "", "mismatch_filename",
+            filename);
+
+    uvm::uvm_config_db<int>::get(this, "", "mismatch_differences",
+            differences);
+
+    uvm::uvm_config_db<int>::get(this, "", "mismatch_context", context);
+
+    uvm::uvm_config_db<bool>::get(this, "", "streaming", m_streaming);
+
+    uvm::uvm_config_db<int>::get(this, "", "stream_lookahead", lookahead);
+
+    uvm::uvm_config_db<int>::get(this, "", "compare_workers", workers);
+
+    uvm::uvm_config_db<int>::get(this, "", "compare_depth", depth);
+
+    m_diff = packet_diff{
+        std::size_t(std::max(differences, 1)),
+        std::size_t(std::max(context, 0))
+    };
+
+    m_stream_diff = stream_diff{std::size_t(std::max(differences, 1))};
+    m_lookahead = std::size_t(std::max(lookahead, 1));
+    m_rx_beat_fifo.capacity = m_lookahead;
+    m_tx_beat_fifo.capacity = m_lookahead;
+
+    if (m_streaming && (workers > 0)) {
+        UVM_WARNING(get_name(), "Compare workers are not supported in"
+                " streaming mode, comparing in simulation thread");
+    }
+    else if (workers > 0) {
+        m_pool.reset(new compare_pool{
+            std::size_t(workers),
+            std::size_t(std::max(depth, 1)),
+            m_diff
+        });
+    }
+
+    if (m_streaming && ("none" != format_name)) {
+        UVM_WARNING(get_name(), "Mismatch format " + format_name +
+                " is not supported in streaming mode, using none");
+        format_name = "none";
+    }
+
+    if ("none" == format_name) {
+        return;
+    }
+
+    auto format = packet_writer::JSON;
+    auto encoding = packet_writer::BASE64;
+
+    if (!packet_writer::to_format(format_name, format)) {
+        UVM_WARNING(get_name(), "Unknown mismatch format " + format_name +
+                ", using json");
+    }
+
+    if (!packet_writer::to_encoding(encoding_name, encoding)) {
+        UVM_WARNING(get_name(), "Unknown mismatch encoding " +
+                encoding_name + ", using base64");
+    }
+
+    filename = logic::get_output_filename(filename);
+
+    if (!filename.empty()) {
+        m_mismatch_file.open(filename, std::ios::binary | std::ios::trunc);
+
+        if (!m_mismatch_file) {
+            UVM_FATAL(get_name(), "Cannot create mismatch file " +
+                    filename + "! Simulation aborted!");
+        }
+    }
+    else if (packet_writer::MSGPACK == format) {
+        UVM_WARNING(get_name(), "Binary mismatch format requires"
+                " mismatch_filename, using ndjson");
+        format = packet_writer::NDJSON;
+    }
+
+    m_mismatch_writer.reset(new packet_writer{
+        m_mismatch_file.is_open() ? m_mismatch_file : std::cout,
+        format,
+        encoding
+    });
+}
+
 void scoreboard::connect_phase(uvm::uvm_phase& phase) {
     uvm::uvm_scoreboard::connect_phase(phase);
 
     rx_analysis_export.connect(m_rx_fifo);
     tx_analysis_export.connect(m_tx_fifo);
+    rx_beat_analysis_export.connect(m_rx_beat_fifo);
+    tx_beat_analysis_export.connect(m_tx_beat_fifo);
 }
 
 void scoreboard::run_phase(uvm::uvm_phase& /* phase */) {
     UVM_INFO(get_name(), "Run phase", uvm::UVM_FULL);
 
+    if (m_streaming) {
+        run_streaming();
+    }
+
+    if (nullptr != m_pool) {
+        run_pool();
+    }
+
     while (true) {
         *m_rx_packet = m_rx_fifo.get(nullptr);
         *m_tx_packet = m_tx_fifo.get(nullptr);
 
-        if (!m_rx_packet->compare(*m_tx_packet)) {
-            m_error = true;
+        LOGIC_PROFILE_SCOPE(timer, "run_phase");
+        LOGIC_PROFILE_COUNT("packets", 1);
+
+        if (!m_diff.compare(*m_rx_packet, *m_tx_packet)) {
+            mismatch(m_diff.report(), *m_rx_packet, *m_tx_packet);
+        }
+    }
+}
+
+void scoreboard::run_pool() {
+    while (true) {
+        auto slot = m_pool->acquire();
+
+        while (nullptr == slot) {
+            collect(true, 1);
+            slot = m_pool->acquire();
+        }
+
+        /* Packets returned by FIFOs are moved straight into the job slot */
+        slot->expected = m_rx_fifo.get(nullptr);
+        slot->actual = m_tx_fifo.get(nullptr);
+
+        LOGIC_PROFILE_SCOPE(timer, "run_pool");
+        LOGIC_PROFILE_COUNT("packets", 1);
+
+        m_pool->submit();
+        collect(false);
+    }
+}
+
+void scoreboard::extract_phase(uvm::uvm_phase& phase) {
+    uvm::uvm_scoreboard::extract_phase(phase);
+
+    if (nullptr != m_pool) {
+        collect(true);
+    }
+}
+
+std::size_t scoreboard::collect(bool wait, std::size_t limit) {
+    return m_pool->collect(wait, [this] (compare_pool::job& value) {
+        if (!value.equal) {
+            mismatch(value.report, value.expected, value.actual);
+        }
+    }, limit);
+}
 
-            m_rx_packet->set_name("rx");
-            m_tx_packet->set_name("tx");
+void scoreboard::mismatch(const std::string& report, packet& rx,
+        packet& tx) {
+    m_error = true;
+    logic::trace_base::trigger();
 
-            logic::printer::json json_printer;
-            m_rx_packet->print(&json_printer);
-            m_tx_packet->print(&json_printer);
+    UVM_ERROR(get_name(), report);
+
+    if (m_mismatch_writer != nullptr) {
+        rx.set_name("rx");
+        tx.set_name("tx");
+
+        m_mismatch_writer->write(rx);
+        m_mismatch_writer->write(tx);
+        m_mismatch_writer->flush();
+    }
+}
+
+void scoreboard::run_streaming() {
+    std::size_t dropped{0};
+
+    while (true) {
+        const auto side = m_stream_diff.next();
+        const bool expected = (stream_diff::EXPECTED == side);
+
+        m_beat = (expected ? m_rx_beat_fifo : m_tx_beat_fifo).get(nullptr);
+
+        LOGIC_PROFILE_SCOPE(timer, "run_streaming");
+
+        if (0 == dropped) {
+            dropped = m_rx_beat_fifo.dropped + m_tx_beat_fifo.dropped;
+
+            if (0 != dropped) {
+                const std::string ahead{
+                    (0 != m_rx_beat_fifo.dropped) ? "Rx" : "Tx"};
+
+                m_error = true;
+                logic::trace_base::trigger();
+
+                UVM_ERROR(get_name(), ahead + " side is more than " +
+                        std::to_string(m_lookahead) +
+                        " beats ahead, excess beats are dropped");
+            }
+        }
+
+        m_stream_diff.push(side, m_beat);
+
+        if (!m_stream_diff.done()) {
+            continue;
         }
+
+        LOGIC_PROFILE_COUNT("packets", 1);
+
+        if (!m_stream_diff.equal()) {
+            m_error = true;
+            logic::trace_base::trigger();
+
+            UVM_ERROR(get_name(), m_stream_diff.report());
+        }
+
+        m_stream_diff.clear();
     }
 }
@@ -22,6 +22,7 @@
 #include "logic/axi4/stream/sequencer.hpp"
 #include "logic/axi4/stream/tx_sequence.hpp"
 #include "logic/axi4/stream/tx_sequencer.hpp"
+#include "logic/checkpoint.hpp"
 
 #include <systemc>
 
@@ -81,7 +82,10 @@ void sequence::pre_body() {
 void sequence::body() {
     UVM_INFO(get_name(), "Starting sequence", uvm::UVM_FULL);
 
-    reset->start(m_reset_sequencer);
+    if (!logic::checkpoint::restore("reset")) {
+        reset->start(m_reset_sequencer);
+        logic::checkpoint::save("reset");
+    }
 
     SC_FORK
         sc_core::sc_spawn(
@@ -0,0 +1,337 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/stimulus.hpp"
+
+#include "logic/axi4/stream/rx_sequence_item.hpp"
+
+#include "binary.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+using logic::axi4::stream::stimulus_reader;
+using logic::axi4::stream::stimulus_writer;
+using logic::axi4::stream::rx_sequence_item;
+using logic::axi4::stream::tdata_byte;
+using logic::axi4::stream::binary::bytes;
+using logic::axi4::stream::binary::load;
+using logic::axi4::stream::binary::store;
+
+/*
+ * File layout, all values are stored in little-endian byte order:
+ *
+ * header:
+ *  [0:7]   magic "LGCSTIM\0"
+ *  [8:11]  version
+ *  [12:15] reserved
+ *  [16:23] number of records
+ *  [24:31] number of data records (packets)
+ *
+ * record:
+ *  [0:7]   record size in bytes including this field
+ *  [8]     record type: data or idle
+ *  [9]     flags: tdata byte types present
+ *  [10:15] reserved
+ *  [16:23] idle min
+ *  [24:31] idle max
+ *  [32:39] timeout
+ *  [40:43] tid width in bits
+ *  [44:47] tdest width in bits
+ *  [48:51] tuser width in bits
+ *  [52:55] number of tuser transfers
+ *  [56:63] number of tdata bytes
+ *  [64:]   tid, tdest, tuser transfers, tdata bytes, tdata byte types
+ */
+
+static constexpr std::array<std::uint8_t, 8> MAGIC{{
+    'L', 'G', 'C', 'S', 'T', 'I', 'M', '\0'
+}};
+
+static constexpr std::uint32_t VERSION{1};
+static constexpr std::size_t HEADER_SIZE{32};
+static constexpr std::size_t RECORD_HEADER_SIZE{64};
+
+static constexpr std::uint8_t DATA_RECORD{0};
+static constexpr std::uint8_t IDLE_RECORD{1};
+
+static constexpr std::uint8_t FLAG_TDATA_TYPES{0x01};
+
+stimulus_writer::stimulus_writer(const std::string& filename) :
+    m_file{filename, std::ios::binary | std::ios::trunc},
+    m_buffer{},
+    m_records{0},
+    m_packets{0}
+{
+    if (!m_file) {
+        throw std::runtime_error("Cannot create stimulus file " + filename);
+    }
+
+    m_buffer.assign(HEADER_SIZE, 0);
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()),
+            std::streamsize(m_buffer.size()));
+}
+
+stimulus_writer::~stimulus_writer() {
+    try {
+        close();
+    }
+    catch (...) { }
+}
+
+void stimulus_writer::write(const rx_sequence_item& item) {
+    const bool typed = std::any_of(item.tdata.cbegin(), item.tdata.cend(),
+        [] (const tdata_byte& value) {
+            return !value.is_data_byte();
+        }
+    );
+
+    const std::size_t tuser_width = item.tuser.empty() ?
+        0u : item.tuser[0].size();
+
+    m_buffer.clear();
+
+    store<std::uint64_t>(m_buffer, 0);
+    store<std::uint8_t>(m_buffer, (rx_sequence_item::IDLE == item.type) ?
+            IDLE_RECORD : DATA_RECORD);
+    store<std::uint8_t>(m_buffer, std::uint8_t(typed ? FLAG_TDATA_TYPES : 0));
+    store<std::uint16_t>(m_buffer, 0);
+    store<std::uint32_t>(m_buffer, 0);
+    store<std::uint64_t>(m_buffer, item.idle.min());
+    store<std::uint64_t>(m_buffer, item.idle.max());
+    store<std::uint64_t>(m_buffer, item.timeout);
+    store<std::uint32_t>(m_buffer, std::uint32_t(item.tid.size()));
+    store<std::uint32_t>(m_buffer, std::uint32_t(item.tdest.size()));
+    store<std::uint32_t>(m_buffer, std::uint32_t(tuser_width));
+    store<std::uint32_t>(m_buffer, std::uint32_t(item.tuser.size()));
+    store<std::uint64_t>(m_buffer, item.tdata.size());
+
+    store(m_buffer, item.tid, item.tid.size());
+    store(m_buffer, item.tdest, item.tdest.size());
+
+    for (const auto& tuser : item.tuser) {
+        store(m_buffer, tuser, tuser_width);
+    }
+
+    for (const auto& tdata : item.tdata) {
+        m_buffer.push_back(tdata.data());
+    }
+
+    if (typed) {
+        for (const auto& tdata : item.tdata) {
+            m_buffer.push_back(std::uint8_t(tdata.type()));
+        }
+    }
+
+    const auto size = std::uint64_t(m_buffer.size());
+
+    for (std::size_t i = 0u; i < sizeof(size); ++i) {
+        m_buffer[i] = std::uint8_t(size >> (8u * i));
+    }
+
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()),
+            std::streamsize(m_buffer.size()));
+
+    if (!m_file) {
+        throw std::runtime_error("Cannot write stimulus file");
+    }
+
+    ++m_records;
+
+    if (rx_sequence_item::DATA == item.type) {
+        ++m_packets;
+    }
+}
+
+void stimulus_writer::close() {
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    m_buffer.assign(MAGIC.cbegin(), MAGIC.cend());
+    store<std::uint32_t>(m_buffer, VERSION);
+    store<std::uint32_t>(m_buffer, 0);
+    store<std::uint64_t>(m_buffer, m_records);
+    store<std::uint64_t>(m_buffer, m_packets);
+
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()),
+            std::streamsize(m_buffer.size()));
+    m_file.close();
+
+    if (!m_file) {
+        throw std::runtime_error("Cannot finalize stimulus file");
+    }
+}
+
+auto stimulus_writer::records() const noexcept -> std::size_t {
+    return m_records;
+}
+
+auto stimulus_writer::packets() const noexcept -> std::size_t {
+    return m_packets;
+}
+
+stimulus_reader::stimulus_reader(const std::string& filename) :
+    m_begin{nullptr},
+    m_end{nullptr},
+    m_position{nullptr},
+    m_size{0},
+    m_records{0},
+    m_packets{0},
+    m_filename{filename}
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open stimulus file " + filename);
+    }
+
+    struct stat status{};
+
+    if ((::fstat(fd, &status) != 0) ||
+            (std::size_t(status.st_size) < HEADER_SIZE)) {
+        ::close(fd);
+        throw std::runtime_error("Invalid stimulus file " + filename);
+    }
+
+    m_size = std::size_t(status.st_size);
+
+    void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (MAP_FAILED == address) {
+        throw std::runtime_error("Cannot map stimulus file " + filename);
+    }
+
+    ::madvise(address, m_size, MADV_SEQUENTIAL);
+
+    m_begin = static_cast<const std::uint8_t*>(address);
+    m_end = m_begin + m_size;
+
+    auto position = m_begin;
+
+    const bool valid = std::equal(MAGIC.cbegin(), MAGIC.cend(), position);
+    position += MAGIC.size();
+
+    const auto version = load<std::uint32_t>(position);
+    position += sizeof(std::uint32_t);
+
+    m_records = std::size_t(load<std::uint64_t>(position));
+    m_packets = std::size_t(load<std::uint64_t>(position));
+
+    if (!valid || (VERSION != version)) {
+        ::munmap(const_cast<std::uint8_t*>(m_begin), m_size);
+        throw std::runtime_error("Invalid stimulus file " + filename);
+    }
+
+    rewind();
+}
+
+stimulus_reader::~stimulus_reader() {
+    ::munmap(const_cast<std::uint8_t*>(m_begin), m_size);
+}
+
+void stimulus_reader::rewind() noexcept {
+    m_position = m_begin + HEADER_SIZE;
+}
+
+auto stimulus_reader::records() const noexcept -> std::size_t {
+    return m_records;
+}
+
+auto stimulus_reader::packets() const noexcept -> std::size_t {
+    return m_packets;
+}
+
+bool stimulus_reader::read(rx_sequence_item& item) {
+    const auto available = std::size_t(m_end - m_position);
+
+    if (0 == available) {
+        return false;
+    }
+
+    if (available < RECORD_HEADER_SIZE) {
+        throw std::runtime_error("Truncated stimulus file " + m_filename);
+    }
+
+    auto position = m_position;
+
+    const auto size = std::size_t(load<std::uint64_t>(position));
+    const auto type = load<std::uint8_t>(position);
+    const auto flags = load<std::uint8_t>(position);
+    position += sizeof(std::uint16_t) + sizeof(std::uint32_t);
+
+    const auto idle_min = std::size_t(load<std::uint64_t>(position));
+    const auto idle_max = std::size_t(load<std::uint64_t>(position));
+    const auto timeout = std::size_t(load<std::uint64_t>(position));
+    const std::size_t tid_width = load<std::uint32_t>(position);
+    const std::size_t tdest_width = load<std::uint32_t>(position);
+    const std::size_t tuser_width = load<std::uint32_t>(position);
+    const std::size_t tuser_count = load<std::uint32_t>(position);
+    const auto tdata_count = std::size_t(load<std::uint64_t>(position));
+
+    const bool typed = (0 != (flags & FLAG_TDATA_TYPES));
+
+    const std::size_t expected = RECORD_HEADER_SIZE + bytes(tid_width) +
+        bytes(tdest_width) + (tuser_count * bytes(tuser_width)) +
+        (typed ? (2u * tdata_count) : tdata_count);
+
+    if ((size > available) || (size != expected) || (type > IDLE_RECORD)) {
+        throw std::runtime_error("Corrupted stimulus file " + m_filename);
+    }
+
+    item.type = (IDLE_RECORD == type) ?
+        rx_sequence_item::IDLE : rx_sequence_item::DATA;
+    item.idle = logic::range{idle_min, idle_max};
+    item.timeout = timeout;
+
+    load(position, item.tid, tid_width);
+    load(position, item.tdest, tdest_width);
+
+    item.tuser.resize(tuser_count);
+
+    for (auto& tuser : item.tuser) {
+        load(position, tuser, tuser_width);
+    }
+
+    item.tdata.resize(tdata_count);
+
+    const auto types = position + tdata_count;
+
+    for (std::size_t i = 0u; i < tdata_count; ++i) {
+        auto tdata_type = tdata_byte::DATA_BYTE;
+
+        if (typed) {
+            if (types[i] > tdata_byte::RESERVED) {
+                throw std::runtime_error("Corrupted stimulus file " +
+                        m_filename);
+            }
+            tdata_type = tdata_byte::type_t(types[i]);
+        }
+
+        item.tdata[i] = tdata_byte{position[i], tdata_type};
+    }
+
+    m_position += size;
+
+    return true;
+}
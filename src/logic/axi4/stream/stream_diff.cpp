@@ -0,0 +1,293 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/stream_diff.hpp"
+#include "logic/axi4/stream/beat.hpp"
+
+#include "hex.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+
+using logic::axi4::stream::stream_diff;
+using logic::axi4::stream::hex::append;
+using logic::axi4::stream::hex::to_string;
+using logic::axi4::stream::hex::type_name;
+
+static constexpr std::uint64_t FNV_OFFSET{0xcbf29ce484222325};
+static constexpr std::uint64_t FNV_PRIME{0x100000001b3};
+
+static std::uint64_t fnv1a(std::uint64_t hash, std::uint8_t value) noexcept {
+    return (hash ^ value) * FNV_PRIME;
+}
+
+static void append_hash(std::string& output, std::uint64_t hash) {
+    output += "0x";
+
+    for (std::size_t i = sizeof(hash); i > 0u; --i) {
+        append(output, std::uint8_t(hash >> (8u * (i - 1u))));
+    }
+}
+
+static stream_diff::side_t other(stream_diff::side_t side) noexcept {
+    return (stream_diff::EXPECTED == side) ?
+        stream_diff::ACTUAL : stream_diff::EXPECTED;
+}
+
+stream_diff::stream_diff(std::size_t max_differences) :
+    m_max_differences{max_differences},
+    m_state{},
+    m_pending_tdata{},
+    m_pending_tuser{},
+    m_tdata_side{EXPECTED},
+    m_tuser_side{EXPECTED},
+    m_offset{0},
+    m_transfer{0},
+    m_tdata_mismatches{0},
+    m_tuser_mismatches{0},
+    m_tuser{},
+    m_differences{},
+    m_first_mismatch{},
+    m_tid_mismatch{false},
+    m_tdest_mismatch{false}
+{
+    clear();
+}
+
+stream_diff::~stream_diff() = default;
+
+void stream_diff::clear() {
+    for (auto& value : m_state) {
+        value = state{};
+        value.hash = FNV_OFFSET;
+    }
+
+    m_pending_tdata.clear();
+    m_pending_tuser.clear();
+    m_offset = 0;
+    m_transfer = 0;
+    m_tdata_mismatches = 0;
+    m_tuser_mismatches = 0;
+    m_tuser.clear();
+    m_differences.clear();
+    m_first_mismatch = sc_core::SC_ZERO_TIME;
+    m_tid_mismatch = false;
+    m_tdest_mismatch = false;
+}
+
+auto stream_diff::next() const noexcept -> side_t {
+    if (m_state[EXPECTED].done) {
+        return ACTUAL;
+    }
+
+    if (m_state[ACTUAL].done) {
+        return EXPECTED;
+    }
+
+    return (!m_pending_tdata.empty() && (EXPECTED == m_tdata_side)) ?
+        ACTUAL : EXPECTED;
+}
+
+bool stream_diff::done() const noexcept {
+    return m_state[EXPECTED].done && m_state[ACTUAL].done;
+}
+
+void stream_diff::push(side_t side, const beat& value) {
+    auto& current = m_state[side];
+    const auto& opposite = m_state[other(side)];
+
+    if (0 == current.transfers) {
+        current.tid = value.tid;
+        current.tdest = value.tdest;
+
+        if (0 != opposite.transfers) {
+            m_tid_mismatch = !(opposite.tid == value.tid);
+            m_tdest_mismatch = !(opposite.tdest == value.tdest);
+        }
+    }
+    else if (!(current.tid == value.tid) || !(current.tdest == value.tdest)) {
+        current.interleaved = true;
+    }
+
+    ++current.transfers;
+    compare_tuser(side, value.tuser);
+
+    for (const auto& tdata : value.tdata) {
+        compare_tdata(side, tdata, value.timestamp);
+    }
+
+    current.done = value.tlast;
+}
+
+void stream_diff::compare_tuser(side_t side, const bitstream& tuser) {
+    if (m_pending_tuser.empty() || (m_tuser_side == side)) {
+        if (!m_state[other(side)].done) {
+            m_pending_tuser.push_back(tuser);
+            m_tuser_side = side;
+        }
+        return;
+    }
+
+    if (!(m_pending_tuser.front() == tuser)) {
+        if (m_tuser.size() < m_max_differences) {
+            m_tuser.push_back(m_transfer);
+        }
+        ++m_tuser_mismatches;
+    }
+
+    m_pending_tuser.pop_front();
+    ++m_transfer;
+}
+
+void stream_diff::compare_tdata(side_t side, const tdata_byte& value,
+        const sc_core::sc_time& timestamp) {
+    auto& current = m_state[side];
+
+    current.hash = fnv1a(fnv1a(current.hash, value.data()),
+            std::uint8_t(value.type()));
+    ++current.size;
+
+    if (m_pending_tdata.empty() || (m_tdata_side == side)) {
+        if (!m_state[other(side)].done) {
+            m_pending_tdata.push_back(value);
+            m_tdata_side = side;
+        }
+        return;
+    }
+
+    const auto& pending = m_pending_tdata.front();
+
+    if (!(pending == value)) {
+        if (0 == m_tdata_mismatches) {
+            m_first_mismatch = timestamp;
+        }
+
+        if (m_differences.size() < m_max_differences) {
+            m_differences.push_back({
+                m_offset,
+                (EXPECTED == side) ? value : pending,
+                (EXPECTED == side) ? pending : value
+            });
+        }
+
+        ++m_tdata_mismatches;
+    }
+
+    m_pending_tdata.pop_front();
+    ++m_offset;
+}
+
+bool stream_diff::equal() const noexcept {
+    return !m_tid_mismatch && !m_tdest_mismatch &&
+        !m_state[EXPECTED].interleaved && !m_state[ACTUAL].interleaved &&
+        (m_state[EXPECTED].transfers == m_state[ACTUAL].transfers) &&
+        (0u == m_tuser_mismatches) && (0u == m_tdata_mismatches) &&
+        (m_state[EXPECTED].size == m_state[ACTUAL].size);
+}
+
+auto stream_diff::size(side_t side) const noexcept -> std::size_t {
+    return m_state[side].size;
+}
+
+auto stream_diff::hash(side_t side) const noexcept -> std::uint64_t {
+    return m_state[side].hash;
+}
+
+auto stream_diff::differences() const noexcept
+        -> const std::vector<difference>& {
+    return m_differences;
+}
+
+std::string stream_diff::report() const {
+    std::string output;
+
+    if (equal()) {
+        return output;
+    }
+
+    output += "Packet mismatch\n";
+
+    for (const auto side : {EXPECTED, ACTUAL}) {
+        if (m_state[side].interleaved) {
+            output += (EXPECTED == side) ? "  expected" : "  actual";
+            output += ": tid or tdest changed within packet, interleaved"
+                " packets cannot be compared in streaming mode\n";
+        }
+    }
+
+    if (m_tid_mismatch) {
+        output += "  tid: expected " + to_string(m_state[EXPECTED].tid) +
+            " actual " + to_string(m_state[ACTUAL].tid) + "\n";
+    }
+
+    if (m_tdest_mismatch) {
+        output += "  tdest: expected " + to_string(m_state[EXPECTED].tdest) +
+            " actual " + to_string(m_state[ACTUAL].tdest) + "\n";
+    }
+
+    if (m_state[EXPECTED].transfers != m_state[ACTUAL].transfers) {
+        output += "  tuser: transfers count differs\n";
+    }
+
+    if (0u != m_tuser_mismatches) {
+        output += "  tuser: " + std::to_string(m_tuser_mismatches) +
+            " mismatching transfers, first at";
+
+        for (const auto transfer : m_tuser) {
+            output += " " + std::to_string(transfer);
+        }
+
+        output.push_back('\n');
+    }
+
+    if (m_state[EXPECTED].size != m_state[ACTUAL].size) {
+        output += "  tdata: size expected " +
+            std::to_string(m_state[EXPECTED].size) + " actual " +
+            std::to_string(m_state[ACTUAL].size) + "\n";
+    }
+
+    output += "  tdata: hash expected ";
+    append_hash(output, m_state[EXPECTED].hash);
+    output += " actual ";
+    append_hash(output, m_state[ACTUAL].hash);
+    output.push_back('\n');
+
+    if (0u == m_tdata_mismatches) {
+        return output;
+    }
+
+    output += "  tdata: " + std::to_string(m_tdata_mismatches) +
+        " mismatching bytes, first at " + m_first_mismatch.to_string() +
+        "\n";
+
+    for (const auto& diff : m_differences) {
+        output += "    offset " + std::to_string(diff.offset) +
+            ": expected 0x";
+        append(output, diff.expected.data());
+        output += " actual 0x";
+        append(output, diff.actual.data());
+
+        if (diff.expected.type() != diff.actual.type()) {
+            output += " type expected ";
+            output += type_name(diff.expected.type());
+            output += " actual ";
+            output += type_name(diff.actual.type());
+        }
+
+        output.push_back('\n');
+    }
+
+    return output;
+}
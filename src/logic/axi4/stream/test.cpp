@@ -16,6 +16,7 @@
 #include "logic/axi4/stream/test.hpp"
 
 #include "logic/axi4/stream/scoreboard.hpp"
+#include "logic/profile.hpp"
 
 using logic::axi4::stream::test;
 
@@ -74,6 +75,11 @@ void test::report_phase(uvm::uvm_phase& phase) {
         UVM_ERROR(get_name(), "TEST FAILED");
     }
 
+#if defined(LOGIC_PROFILE)
+    UVM_INFO(get_name(), logic::profile::summary(), uvm::UVM_NONE);
+    logic::profile::write_trace();
+#endif
+
     uvm::uvm_root::get()->set_finish_on_completion(true);
     uvm::uvm_report_server::get_server()->report_summarize();
     sc_core::sc_stop();
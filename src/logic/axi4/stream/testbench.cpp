@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "logic/axi4/stream/recorder.hpp"
 #include "logic/axi4/stream/reset_agent.hpp"
 #include "logic/axi4/stream/rx_agent.hpp"
 #include "logic/axi4/stream/scoreboard.hpp"
@@ -34,7 +35,9 @@ testbench::testbench(const uvm::uvm_component_name& component_name) :
     m_rx_agent{nullptr},
     m_tx_agent{nullptr},
     m_scoreboard{nullptr},
-    m_reset_agent{nullptr}
+    m_reset_agent{nullptr},
+    m_rx_recorder{nullptr},
+    m_tx_recorder{nullptr}
 {
     UVM_INFO(get_name(), "Constructor", uvm::UVM_FULL);
 }
@@ -76,6 +79,40 @@ void testbench::build_phase(uvm::uvm_phase& phase) {
                 " Simulation aborted!");
     }
 
+    std::string record_filename;
+    bool streaming{false};
+
+    uvm::uvm_config_db<std::string>::get(this, "", "record_filename",
+            record_filename);
+
+    uvm::uvm_config_db<bool>::get(this, "", "streaming", streaming);
+
+    if (streaming && !record_filename.empty()) {
+        UVM_WARNING(get_name(), "Recording whole packets is not supported"
+                " in streaming mode, recorders are disabled");
+        record_filename.clear();
+    }
+
+    if (!record_filename.empty()) {
+        m_rx_recorder = recorder::type_id::create("rx_recorder", this);
+        if (m_rx_recorder == nullptr) {
+            UVM_FATAL(get_name(), "Cannot create Rx recorder!"
+                    " Simulation aborted!");
+        }
+
+        m_tx_recorder = recorder::type_id::create("tx_recorder", this);
+        if (m_tx_recorder == nullptr) {
+            UVM_FATAL(get_name(), "Cannot create Tx recorder!"
+                    " Simulation aborted!");
+        }
+
+        uvm::uvm_config_db<std::string>::set(this, "rx_recorder",
+                "filename", record_filename + "_rx.tlog");
+
+        uvm::uvm_config_db<std::string>::set(this, "tx_recorder",
+                "filename", record_filename + "_tx.tlog");
+    }
+
     uvm::uvm_config_db<int>::set(this, "rx_agent", "is_active",
             uvm::UVM_ACTIVE);
 
@@ -97,6 +134,19 @@ void testbench::connect_phase(uvm::uvm_phase& phase) {
 
     m_rx_agent->analysis_port.connect(m_scoreboard->rx_analysis_export);
     m_tx_agent->analysis_port.connect(m_scoreboard->tx_analysis_export);
+
+    m_rx_agent->beat_analysis_port.connect(
+            m_scoreboard->rx_beat_analysis_export);
+    m_tx_agent->beat_analysis_port.connect(
+            m_scoreboard->tx_beat_analysis_export);
+
+    if (m_rx_recorder != nullptr) {
+        m_rx_agent->analysis_port.connect(m_rx_recorder->analysis_export);
+    }
+
+    if (m_tx_recorder != nullptr) {
+        m_tx_agent->analysis_port.connect(m_tx_recorder->analysis_export);
+    }
 }
 
 bool testbench::passed() const noexcept {
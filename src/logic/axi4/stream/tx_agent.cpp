@@ -15,6 +15,7 @@
 
 #include "logic/axi4/stream/tx_agent.hpp"
 
+#include "logic/axi4/stream/beat.hpp"
 #include "logic/axi4/stream/monitor.hpp"
 #include "logic/axi4/stream/tx_driver.hpp"
 #include "logic/axi4/stream/tx_sequencer.hpp"
@@ -28,6 +29,7 @@ tx_agent::tx_agent() :
 tx_agent::tx_agent(const uvm::uvm_component_name& component_name) :
     uvm::uvm_agent{component_name},
     analysis_port{"analysis_port"},
+    beat_analysis_port{"beat_analysis_port"},
     sequencer{nullptr},
     m_monitor{nullptr},
     m_driver{nullptr}
@@ -73,6 +75,7 @@ void tx_agent::connect_phase(uvm::uvm_phase& phase) {
     UVM_INFO(get_name(), "Connect phase", uvm::UVM_FULL);
 
     m_monitor->analysis_port.connect(analysis_port);
+    m_monitor->beat_analysis_port.connect(beat_analysis_port);
 
     if (get_is_active() == uvm::UVM_ACTIVE) {
         m_driver->seq_item_port.connect(sequencer->seq_item_export);
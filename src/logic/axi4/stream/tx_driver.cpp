@@ -17,6 +17,12 @@
 
 #include "logic/axi4/stream/bus_if_base.hpp"
 #include "logic/axi4/stream/tx_sequence_item.hpp"
+#include "logic/checkpoint.hpp"
+#include "logic/profile.hpp"
+#include "logic/seed.hpp"
+
+#include <algorithm>
+#include <fstream>
 
 using logic::axi4::stream::tx_driver;
 using logic::axi4::stream::tx_sequence_item;
@@ -38,8 +44,18 @@ void tx_driver::build_phase(uvm::uvm_phase& phase) {
     uvm::uvm_driver<tx_sequence_item>::build_phase(phase);
     UVM_INFO(get_name(), "Build phase", uvm::UVM_FULL);
 
-    std::random_device rd;
-    m_random_generator.seed(rd());
+    m_random_generator.seed(logic::get_seed(get_full_name()));
+
+    logic::checkpoint::add(get_full_name(),
+        [this] (const std::string& filename) {
+            std::ofstream file{filename, std::ios::trunc};
+            file << m_random_generator;
+        },
+        [this] (const std::string& filename) {
+            std::ifstream file{filename};
+            file >> m_random_generator;
+        }
+    );
 
     auto ok = uvm::uvm_config_db<bus_if_base*>::get(this, "*", "vif", m_vif);
 
@@ -77,6 +93,8 @@ void tx_driver::transfer(const tx_sequence_item& item) {
     m_vif->set_tready(true);
 
     while ((is_running || (0 != idle)) && m_vif->get_areset_n()) {
+        LOGIC_PROFILE_SCOPE(timer, "transfer");
+
         if (is_running && m_vif->get_tready() && m_vif->get_tvalid()
                 && (item.tid == m_vif->get_tid())
                 && (item.tdest == m_vif->get_tdest())) {
@@ -95,6 +113,8 @@ void tx_driver::transfer(const tx_sequence_item& item) {
             }
         }
 
+        std::size_t skip = 0;
+
         if (0 == idle) {
             idle = is_running ? random_idle(m_random_generator) : 0;
             m_vif->set_tready(true);
@@ -102,9 +122,21 @@ void tx_driver::transfer(const tx_sequence_item& item) {
         else {
             --idle;
             m_vif->set_tready(false);
+
+            /* With deasserted tready only idle and timeout count down */
+            skip = (is_running && (0 != item.timeout)) ?
+                std::min(idle, timeout) : idle;
         }
 
-        m_vif->aclk_posedge();
+        LOGIC_PROFILE_STOP(timer);
+
+        const std::size_t skipped = m_vif->aclk_posedge(1 + skip) - 1;
+
+        idle -= skipped;
+
+        if (is_running && (0 != item.timeout)) {
+            timeout -= skipped;
+        }
     }
 
     m_vif->set_tready(false);
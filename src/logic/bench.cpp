@@ -0,0 +1,185 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/bench.hpp"
+#include "logic/json_escape.hpp"
+#include "logic/output_file.hpp"
+
+#include <sys/resource.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using logic::bench;
+
+static const char TESTNAME[]{"+UVM_TESTNAME="};
+
+static auto get_bench() -> std::unique_ptr<bench>& {
+    static std::unique_ptr<bench> g_bench{};
+    return g_bench;
+}
+
+static auto find_clock(const std::vector<sc_core::sc_object*>& objects)
+        -> const sc_core::sc_clock* {
+    for (const auto object : objects) {
+        auto clock = dynamic_cast<const sc_core::sc_clock*>(object);
+
+        if (nullptr == clock) {
+            clock = find_clock(object->get_child_objects());
+        }
+
+        if (nullptr != clock) {
+            return clock;
+        }
+    }
+
+    return nullptr;
+}
+
+static auto get_clock() -> const sc_core::sc_clock* {
+    auto clock = dynamic_cast<const sc_core::sc_clock*>(
+            sc_core::sc_find_object("aclk"));
+
+    if (nullptr == clock) {
+        clock = find_clock(sc_core::sc_get_top_level_objects());
+    }
+
+    return clock;
+}
+
+static auto get_test_name() -> std::string {
+    const auto argv = sc_core::sc_argv();
+    const auto length = sizeof(TESTNAME) - 1;
+
+    for (int i = 1; i < sc_core::sc_argc(); ++i) {
+        if (0 == std::strncmp(argv[i], TESTNAME, length)) {
+            return argv[i] + length;
+        }
+    }
+
+    return {};
+}
+
+static auto get_peak_rss() -> std::uint64_t {
+    struct rusage usage{};
+
+    if (0 != ::getrusage(RUSAGE_SELF, &usage)) {
+        return 0;
+    }
+
+#if defined(__APPLE__)
+    return std::uint64_t(usage.ru_maxrss) / 1024u;
+#else
+    return std::uint64_t(usage.ru_maxrss);
+#endif
+}
+
+static auto to_json(const std::string& str) -> std::string {
+    return "\"" + logic::escape_json(str) + "\"";
+}
+
+void bench::enable(const std::string& filename) {
+    auto& instance = get_bench();
+
+    if (!instance) {
+        instance.reset(new bench{"logic_bench", filename});
+    }
+}
+
+bench::bench(const sc_core::sc_module_name& name,
+        const std::string& filename) :
+    sc_core::sc_module{name},
+    m_filename{filename}
+{ }
+
+bench::~bench() {
+    try {
+        report();
+    }
+    catch (...) { }
+}
+
+void bench::start_of_simulation() {
+    auto clock = get_clock();
+
+    if (nullptr != clock) {
+        m_period = clock->period();
+    }
+    else {
+        SC_REPORT_WARNING("logic::bench",
+                "Cannot find clock, cycles are not counted");
+    }
+
+    m_time = sc_core::sc_time_stamp();
+    m_delta_cycles = sc_core::sc_delta_count();
+    m_start = std::chrono::steady_clock::now();
+}
+
+void bench::end_of_simulation() {
+    report();
+}
+
+void bench::report() {
+    if (m_reported) {
+        return;
+    }
+
+    m_reported = true;
+
+    const std::chrono::duration<double> wall_time{
+        std::chrono::steady_clock::now() - m_start};
+
+    const auto time = sc_core::sc_time_stamp() - m_time;
+
+    const auto cycles = (sc_core::SC_ZERO_TIME != m_period) ?
+        std::uint64_t(time / m_period) : 0u;
+
+    const auto cycles_per_second = (wall_time.count() > 0.0) ?
+        (double(cycles) / wall_time.count()) : 0.0;
+
+    const auto argv = sc_core::sc_argv();
+
+    std::ostringstream json;
+
+    json << "{\"executable\":" << to_json((sc_core::sc_argc() > 0) ?
+                argv[0] : "")
+        << ",\"test\":" << to_json(get_test_name())
+        << ",\"wall_time\":" << wall_time.count()
+        << ",\"simulated_time\":" << time.to_seconds()
+        << ",\"cycles\":" << cycles
+        << ",\"delta_cycles\":" << (sc_core::sc_delta_count() - m_delta_cycles)
+        << ",\"cycles_per_second\":" << cycles_per_second
+        << ",\"peak_rss_kb\":" << get_peak_rss()
+        << "}";
+
+    std::cout << json.str() << std::endl;
+
+    if (!m_filename.empty()) {
+        const auto filename = logic::get_output_filename(m_filename);
+
+        std::ofstream file{filename, std::ios::trunc};
+
+        file << json.str() << std::endl;
+
+        if (!file) {
+            SC_REPORT_WARNING("logic::bench",
+                    ("Cannot write benchmark file " + filename).c_str());
+        }
+    }
+}
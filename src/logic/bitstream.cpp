@@ -214,16 +214,18 @@ auto bitstream::assign(const void* src, size_type bits) noexcept -> bitstream& {
         bits = m_size;
     }
 
-    ::copy_n(src, bits / BITS, m_bits);
+    const auto count = bits / BITS;
+
+    ::copy_n(src, count, m_bits);
 
     bits %= BITS;
 
     if (bits > 0) {
-        auto byte = static_cast<std::uint8_t*>(m_bits);
+        auto byte = static_cast<std::uint8_t*>(m_bits) + count;
         auto mask = std::uint8_t(~(0xFF << bits));
 
         *byte &= std::uint8_t(~mask);
-        *byte |= (mask & *static_cast<const std::uint8_t*>(src));
+        *byte |= (mask & static_cast<const std::uint8_t*>(src)[count]);
     }
 
     return *this;
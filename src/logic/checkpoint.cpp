@@ -0,0 +1,235 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/checkpoint.hpp"
+#include "logic/output_file.hpp"
+
+#include <uvm>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <utility>
+
+using logic::checkpoint;
+
+namespace {
+
+struct participant {
+    checkpoint::callback save{};
+    checkpoint::callback restore{};
+    bool model{false};
+};
+
+struct checkpoint_options {
+    std::string point{"reset"};
+    std::string save_directory{};
+    std::string restore_directory{};
+    std::map<std::string, participant> participants{};
+    std::set<std::string> saved{};
+    std::set<std::string> restored{};
+};
+
+} /* namespace */
+
+static constexpr const char* CHECKPOINT_FILE{"checkpoint.txt"};
+
+static auto get_options() -> checkpoint_options& {
+    static checkpoint_options g_options{};
+    return g_options;
+}
+
+static auto get_filename(const std::string& directory,
+        const std::string& name) -> std::string {
+    return directory + "/" + name + ".bin";
+}
+
+static bool has_model() {
+    const auto& participants = get_options().participants;
+
+    return std::any_of(participants.cbegin(), participants.cend(),
+        [] (const std::pair<const std::string, participant>& entry) {
+            return entry.second.model;
+        }
+    );
+}
+
+static void add_participant(const std::string& name,
+        const checkpoint::callback& save, const checkpoint::callback& restore,
+        bool model) {
+    auto& entry = get_options().participants[name];
+
+    entry.save = save;
+    entry.restore = restore;
+    entry.model = model;
+}
+
+void checkpoint::add(const std::string& name, const callback& save,
+        const callback& restore) {
+    add_participant(name, save, restore, false);
+}
+
+void checkpoint::add_model(const std::string& name, const callback& save,
+        const callback& restore) {
+    add_participant(name, save, restore, true);
+}
+
+void checkpoint::set_point(const std::string& point) {
+    get_options().point = point;
+}
+
+void checkpoint::enable_save(const std::string& directory) {
+    get_options().save_directory = directory;
+}
+
+void checkpoint::enable_restore(const std::string& directory) {
+    get_options().restore_directory = directory;
+}
+
+bool checkpoint::save(const std::string& point) {
+    auto& options = get_options();
+
+    if (options.save_directory.empty() || (options.point != point) ||
+            (options.saved.count(point) != 0)) {
+        return false;
+    }
+
+    const auto directory = logic::get_output_filename(options.save_directory);
+
+    if (!has_model()) {
+        UVM_FATAL("logic::checkpoint", "No model registered, checkpoint " +
+                point + " cannot be saved to " + directory +
+                "! Simulation aborted!");
+        return false;
+    }
+
+    if ((::mkdir(directory.c_str(), 0755) != 0) && (EEXIST != errno)) {
+        UVM_FATAL("logic::checkpoint", "Cannot create checkpoint directory "
+                + directory + "! Simulation aborted!");
+        return false;
+    }
+
+    std::ofstream file{directory + "/" + CHECKPOINT_FILE, std::ios::trunc};
+
+    if (!file) {
+        UVM_FATAL("logic::checkpoint", "Cannot create checkpoint " +
+                directory + "! Simulation aborted!");
+        return false;
+    }
+
+    file << "point " << point << '\n';
+    file << "time " << sc_core::sc_time_stamp().to_string() << '\n';
+
+    for (const auto& entry : options.participants) {
+        entry.second.save(get_filename(directory, entry.first));
+        file << "participant " << entry.first << '\n';
+    }
+
+    if (!file) {
+        UVM_FATAL("logic::checkpoint", "Cannot write checkpoint " +
+                directory + "! Simulation aborted!");
+        return false;
+    }
+
+    options.saved.insert(point);
+
+    SC_REPORT_INFO("logic::checkpoint", ("Saved checkpoint " + point +
+            " to " + directory).c_str());
+
+    return true;
+}
+
+bool checkpoint::restore(const std::string& point) {
+    auto& options = get_options();
+
+    if (options.restore_directory.empty() || (options.point != point) ||
+            (options.restored.count(point) != 0)) {
+        return false;
+    }
+
+    const auto& directory = options.restore_directory;
+
+    if (!has_model()) {
+        UVM_FATAL("logic::checkpoint", "No model registered, checkpoint " +
+                point + " cannot be restored from " + directory +
+                " and DUT would never be reset! Simulation aborted!");
+        return false;
+    }
+
+    std::ifstream file{directory + "/" + CHECKPOINT_FILE};
+
+    if (!file) {
+        UVM_FATAL("logic::checkpoint", "Cannot open checkpoint " +
+                directory + "! Simulation aborted!");
+        return false;
+    }
+
+    std::string saved_point{};
+    std::string saved_time{};
+    std::set<std::string> saved_participants{};
+    std::string line{};
+
+    while (std::getline(file, line)) {
+        std::istringstream stream{line};
+        std::string key{};
+        std::string value{};
+
+        stream >> key;
+        std::getline(stream >> std::ws, value);
+
+        if ("point" == key) {
+            saved_point = value;
+        }
+        else if ("time" == key) {
+            saved_time = value;
+        }
+        else if ("participant" == key) {
+            saved_participants.insert(value);
+        }
+    }
+
+    if (saved_point != point) {
+        UVM_FATAL("logic::checkpoint", "Checkpoint " + directory +
+                " was saved at point " + saved_point + ", not " + point +
+                "! Simulation aborted!");
+        return false;
+    }
+
+    for (const auto& entry : options.participants) {
+        if (saved_participants.count(entry.first) == 0) {
+            UVM_FATAL("logic::checkpoint", "Checkpoint " + directory +
+                    " has no state for " + entry.first +
+                    "! Simulation aborted!");
+            return false;
+        }
+    }
+
+    for (const auto& entry : options.participants) {
+        entry.second.restore(get_filename(directory, entry.first));
+    }
+
+    options.restored.insert(point);
+
+    SC_REPORT_INFO("logic::checkpoint", ("Restored checkpoint " + point +
+            " from " + directory + " saved at " + saved_time).c_str());
+
+    return true;
+}
@@ -14,6 +14,11 @@
  */
 
 #include "logic/command_line.hpp"
+#include "logic/bench.hpp"
+#include "logic/checkpoint.hpp"
+#include "logic/profile.hpp"
+#include "logic/seed.hpp"
+#include "logic/trace_base.hpp"
 
 #include "command_line_argument.hpp"
 
@@ -58,7 +63,7 @@ split_3(const std::string& arg) -> std::array<std::string, 3> {
     }};
 }
 
-static const std::array<logic::command_line_argument, 4> g_argument{{
+static const std::array<logic::command_line_argument, 15> g_argument{{
     {
         "+UVM_TESTNAME=", [] (const std::string& arg) {
             uvm::uvm_factory::get()->create_component_by_name(
@@ -92,6 +97,61 @@ static const std::array<logic::command_line_argument, 4> g_argument{{
             auto value = split_3(arg);
             uvm::uvm_set_config_int(value[0], value[1], std::stoi(value[2]));
         }
+    },
+    {
+        "+logic_seed=", [] (const std::string& arg) {
+            logic::set_seed(std::uint32_t(std::stoul(arg)));
+        }
+    },
+    {
+        "+trace_format=", [] (const std::string& arg) {
+            logic::trace_base::set_format(arg);
+        }
+    },
+    {
+        "+trace_start=", [] (const std::string& arg) {
+            logic::trace_base::set_start(arg);
+        }
+    },
+    {
+        "+trace_stop=", [] (const std::string& arg) {
+            logic::trace_base::set_stop(arg);
+        }
+    },
+    {
+        "+trace_ring=", [] (const std::string& arg) {
+            logic::trace_base::set_ring(arg);
+        }
+    },
+    {
+        "+logic_checkpoint_save=", [] (const std::string& arg) {
+            logic::checkpoint::enable_save(arg);
+        }
+    },
+    {
+        "+logic_checkpoint_restore=", [] (const std::string& arg) {
+            logic::checkpoint::enable_restore(arg);
+        }
+    },
+    {
+        "+logic_checkpoint=", [] (const std::string& arg) {
+            logic::checkpoint::set_point(arg);
+        }
+    },
+    {
+        "+logic_profile=", [] (const std::string& arg) {
+            logic::profile::enable_trace(arg);
+        }
+    },
+    {
+        "+logic_bench=", [] (const std::string& arg) {
+            logic::bench::enable(arg);
+        }
+    },
+    {
+        "+logic_bench", [] (const std::string& /* arg */) {
+            logic::bench::enable();
+        }
     }
 }};
 
@@ -0,0 +1,45 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/output_file.hpp"
+
+static auto get_suffix() -> std::string& {
+    static std::string g_suffix{};
+    return g_suffix;
+}
+
+void logic::set_output_suffix(const std::string& suffix) {
+    get_suffix() = suffix;
+}
+
+auto logic::get_output_filename(const std::string& filename) -> std::string {
+    const auto& suffix = get_suffix();
+
+    if (suffix.empty() || filename.empty()) {
+        return filename;
+    }
+
+    const auto separator = filename.rfind('/');
+    const auto basename = (std::string::npos == separator) ?
+        0u : (separator + 1u);
+    auto extension = filename.rfind('.');
+
+    if ((std::string::npos == extension) || (extension <= basename)) {
+        extension = filename.size();
+    }
+
+    return filename.substr(0, extension) + "_" + suffix +
+        filename.substr(extension);
+}
@@ -14,202 +14,305 @@
  */
 
 #include "logic/printer/json.hpp"
+#include "logic/hex.hpp"
+#include "logic/json_escape.hpp"
 
-#include <algorithm>
-#include <sstream>
+#include <cstdio>
 
 using logic::printer::json;
 
-namespace {
+static constexpr std::size_t BUFFER_SIZE{64 * 1024};
 
-class json_emitter {
-public:
-    explicit json_emitter(const std::vector<uvm::uvm_printer_row_info>& rows);
+static constexpr std::size_t INDENT{4};
 
-    std::string emit();
-private:
-    using row_iterator = std::vector<uvm::uvm_printer_row_info>::const_iterator;
+static const char DECIMAL_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
 
-    enum type_t {
-        OBJECT,
-        ARRAY
-    };
+template<typename T>
+static unsigned nibble(const T& value, int index) {
+    return unsigned(value.get_word(index / 8) >> (4 * (index % 8))) & 0xFu;
+}
 
-    void print(type_t type);
+template<typename T>
+static unsigned bit(const T& value, int index) {
+    return unsigned(value.get_word(index / 32) >> (index % 32)) & 0x1u;
+}
 
-    void print_indent(int level);
+json::json() :
+    uvm::uvm_printer{},
+    m_buffer{},
+    m_containers{},
+    m_first{true},
+    m_output{nullptr}
+{
+    m_buffer.reserve(BUFFER_SIZE);
+}
 
-    bool is_container() const noexcept;
+json::json(std::ostream& output) :
+    json{}
+{
+    m_output = &output;
+}
 
-    bool is_array() const noexcept;
+json::~json() = default;
 
-    bool is_int() const noexcept;
+void json::key(const std::string& name) const {
+    if (m_containers.empty()) {
+        m_buffer.push_back('{');
+        m_containers.push_back(OBJECT);
+        m_first = true;
+    }
 
-    bool is_hex() const noexcept;
+    if (!m_first) {
+        m_buffer.push_back(',');
+    }
 
-    bool is_bin() const noexcept;
+    m_first = false;
 
-    bool is_double() const noexcept;
+    m_buffer.push_back('\n');
+    m_buffer.append(INDENT * m_containers.size(), ' ');
 
-    row_iterator m_row;
-    row_iterator m_row_begin;
-    row_iterator m_row_end;
-    std::stringstream m_output;
-};
+    if (OBJECT == m_containers.back()) {
+        quoted(name);
+        m_buffer.append(": ");
+    }
+}
 
-json_emitter::json_emitter(const std::vector<uvm::uvm_printer_row_info>& rows) :
-    m_row{},
-    m_row_begin{rows.cbegin()},
-    m_row_end{rows.cend()},
-    m_output{}
-{ }
+void json::open(const std::string& name, container_t container) const {
+    key(name);
 
-auto json_emitter::emit() -> std::string {
-    m_row = m_row_begin;
+    m_buffer.push_back((ARRAY == container) ? '[' : '{');
+    m_containers.push_back(container);
+    m_first = true;
+}
 
-    m_output.str({});
-    m_output.clear();
+void json::close() const {
+    const auto container = m_containers.back();
 
-    print(OBJECT);
+    m_containers.pop_back();
 
-    m_output << std::endl;
+    if (!m_first) {
+        m_buffer.push_back('\n');
+        m_buffer.append(INDENT * m_containers.size(), ' ');
+    }
 
-    return m_output.str();
-}
+    m_buffer.push_back((ARRAY == container) ? ']' : '}');
+    m_first = false;
 
-void json_emitter::print_indent(int level) {
-    while (level-- >= 0) {
-        m_output << "    ";
-    }
+    flush();
 }
 
-bool json_emitter::is_hex() const noexcept {
-    return (0 == m_row->val.find("0x"));
+void json::quoted(const std::string& value) const {
+    m_buffer.push_back('"');
+    logic::append_json_escaped(m_buffer, value);
+    m_buffer.push_back('"');
 }
 
-bool json_emitter::is_bin() const noexcept {
-    return (0 == m_row->val.find("0b"));
-}
+void json::unsigned_integer(std::uint64_t value) const {
+    char digits[20];
+    std::size_t index = sizeof(digits);
 
-bool json_emitter::is_array() const noexcept {
-    return ("array" == m_row->type_name) ||
-        (0 == m_row->type_name.find("std::vector")) ||
-        (0 == m_row->type_name.find("std::array"));
-}
+    while (value >= 100) {
+        const auto pair = 2 * std::size_t(value % 100);
+        value /= 100;
+        digits[--index] = DECIMAL_PAIRS[pair + 1];
+        digits[--index] = DECIMAL_PAIRS[pair];
+    }
 
-bool json_emitter::is_double() const noexcept {
-    return (m_row->type_name == "double");
-}
+    if (value >= 10) {
+        const auto pair = 2 * std::size_t(value);
+        digits[--index] = DECIMAL_PAIRS[pair + 1];
+        digits[--index] = DECIMAL_PAIRS[pair];
+    }
+    else {
+        digits[--index] = char('0' + value);
+    }
 
-bool json_emitter::is_int() const noexcept {
-    return (m_row->type_name == "int");
+    m_buffer.append(digits + index, sizeof(digits) - index);
 }
 
-bool json_emitter::is_container() const noexcept {
-    return ((m_row + 1) != m_row_end) && (m_row->level < (m_row + 1)->level);
-}
+template<typename T>
+void json::hex(const T& value, int size) const {
+    const bool minimal = (size < 1);
+    const int bits = minimal ? value.length() : size;
+    int index = (bits + 3) / 4;
 
-void json_emitter::print(type_t type) {
-    const auto level = (m_row != m_row_end) ? m_row->level : 0;
+    m_buffer.append("\"0x");
 
-    switch (type) {
-    case ARRAY:
-        m_output << "[";
-        break;
-    case OBJECT:
-    default:
-        m_output << "{";
-        break;
+    if (minimal) {
+        while ((index > 1) && (0 == nibble(value, index - 1))) {
+            --index;
+        }
+    }
+    else if (0 != (bits % 4)) {
+        --index;
+        m_buffer.push_back(logic::hex::digit(nibble(value, index) &
+            ((1u << (bits % 4)) - 1u)));
     }
 
-    while ((m_row != m_row_end) && (m_row->level >= level)) {
-        m_output << std::endl;
-        print_indent(level);
+    while (index > 0) {
+        m_buffer.push_back(logic::hex::digit(nibble(value, --index)));
+    }
 
-        if (OBJECT == type) {
-            m_output << "\"" << m_row->name << "\": ";
-        }
+    m_buffer.push_back('"');
+}
 
-        if (is_container()) {
-            if (is_array()) {
-                ++m_row;
-                print(ARRAY);
-            }
-            else {
-                ++m_row;
-                print(OBJECT);
-            }
-        }
-        else if (is_double()) {
-            m_output << m_row->val;
-            ++m_row;
-        }
-        else if (is_int()) {
-            if (is_hex()) {
-                int size = std::stoi(m_row->size);
-
-                if (size < 1) {
-                    size = 1;
-                }
-
-                size = (size + 3) / 4;
-
-                std::string hex(m_row->val.substr(2));
-                std::reverse(hex.begin(), hex.end());
-                hex.resize(std::string::size_type(size), '0');
-                std::reverse(hex.begin(), hex.end());
-
-                m_output << "\"0x" << hex << "\"";
-            }
-            else if (is_bin()) {
-                int size = std::stoi(m_row->size);
-
-                if (size < 1) {
-                    size = 1;
-                }
-
-                std::string bin(m_row->val.substr(2));
-                std::reverse(bin.begin(), bin.end());
-                bin.resize(std::string::size_type(size), '0');
-                std::reverse(bin.begin(), bin.end());
-
-                m_output << "\"0b" << bin << "\"";
-            }
-            else {
-                m_output << m_row->val;
-            }
-
-            ++m_row;
-        }
-        else {
-            m_output << "\"" << m_row->val << "\"";
-            ++m_row;
+template<typename T>
+void json::bin(const T& value, int size) const {
+    int index = (size < 1) ? value.length() : size;
+
+    if (size < 1) {
+        while ((index > 1) && (0 == bit(value, index - 1))) {
+            --index;
         }
+    }
 
-        if ((m_row != m_row_end) && (m_row->level >= level)) {
-            m_output << ",";
+    m_buffer.append("\"0b");
+
+    while (index > 0) {
+        m_buffer.push_back(char('0' + bit(value, --index)));
+    }
+
+    m_buffer.push_back('"');
+}
+
+template<typename T>
+void json::integral(const T& value, int size,
+        uvm::uvm_radix_enum radix) const {
+    switch (radix) {
+    case uvm::UVM_DEC:
+    case uvm::UVM_UNSIGNED:
+    case uvm::UVM_TIME:
+    case uvm::UVM_ENUM:
+        if (size <= 64) {
+            unsigned_integer(value.to_uint64());
         }
         else {
-            m_output << std::endl;
-            print_indent(level - 1);
+            hex(value, size);
         }
-    }
-
-    switch (type) {
-    case ARRAY:
-        m_output << "]";
         break;
-    case OBJECT:
+    case uvm::UVM_BIN:
+        bin(value, size);
+        break;
+    case uvm::UVM_OCT:
+    case uvm::UVM_HEX:
+    case uvm::UVM_STRING:
+    case uvm::UVM_REAL:
+    case uvm::UVM_NORADIX:
     default:
-        m_output << "}";
+        hex(value, size);
         break;
     }
 }
 
-} /* namespace */
+void json::flush() const {
+    if ((m_output != nullptr) && (m_buffer.size() >= BUFFER_SIZE)) {
+        m_output->write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+void json::print_field(const std::string& name,
+        const uvm::uvm_bitstream_t& value, int size,
+        uvm::uvm_radix_enum radix, const char* /* scope_separator */,
+        const std::string& /* type_name */) const {
+    key(name);
+    integral(value, size, radix);
+    flush();
+}
 
-json::~json() = default;
+void json::print_field_int(const std::string& name,
+        const uvm::uvm_integral_t& value, int size,
+        uvm::uvm_radix_enum radix, const char* /* scope_separator */,
+        const std::string& /* type_name */) const {
+    key(name);
+    integral(value, size, radix);
+    flush();
+}
+
+void json::print_object(const std::string& name,
+        const uvm::uvm_object& value, const char* scope_separator) const {
+    open(name.empty() ? value.get_name() : name, OBJECT);
+    uvm::uvm_printer::print_object(name, value, scope_separator);
+    close();
+}
+
+void json::print_object_header(const std::string& /* name */,
+        const uvm::uvm_object& /* value */,
+        const char* /* scope_separator */) const { }
+
+void json::print_string(const std::string& name, const std::string& value,
+        const char* /* scope_separator */) const {
+    key(name);
+    quoted(value);
+    flush();
+}
+
+void json::print_time(const std::string& name, const sc_core::sc_time& value,
+        const char* /* scope_separator */) const {
+    key(name);
+    quoted(value.to_string());
+    flush();
+}
+
+void json::print_real(const std::string& name, double value,
+        const char* /* scope_separator */) const {
+    char text[32];
+    const int length = std::snprintf(text, sizeof(text), "%.17g", value);
+
+    key(name);
+    m_buffer.append(text, (length > 0) ? std::size_t(length) : 0u);
+    flush();
+}
+
+void json::print_generic(const std::string& name,
+        const std::string& /* type_name */, int /* size */,
+        const std::string& value, const char* /* scope_separator */) const {
+    key(name);
+    quoted(value);
+    flush();
+}
+
+void json::print_array_header(const std::string& name, int /* size */,
+        const std::string& /* arraytype */,
+        const char* /* scope_separator */) const {
+    open(name, ARRAY);
+}
+
+void json::print_array_footer(int /* size */) const {
+    if (!m_containers.empty()) {
+        close();
+    }
+}
 
 auto json::emit() -> std::string {
-    return json_emitter{m_rows}.emit();
+    if (m_containers.empty()) {
+        m_buffer.append("{}");
+    }
+
+    while (!m_containers.empty()) {
+        close();
+    }
+
+    m_buffer.push_back('\n');
+    m_first = true;
+    m_rows.clear();
+
+    std::string output;
+
+    if (m_output != nullptr) {
+        m_output->write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        m_output->flush();
+    }
+    else {
+        output = m_buffer;
+    }
+
+    m_buffer.clear();
+
+    return output;
 }
@@ -0,0 +1,257 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/profile.hpp"
+#include "logic/output_file.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using logic::profile;
+
+namespace {
+
+struct profile_entry {
+    std::string name;
+    std::size_t thread;
+    std::uint64_t calls;
+    std::uint64_t count;
+    profile::clock::duration total;
+    profile::clock::duration max;
+};
+
+struct profile_event {
+    std::size_t entry;
+    profile::clock::time_point start;
+    profile::clock::duration duration;
+};
+
+struct profile_data {
+    using key_type = std::pair<const sc_core::sc_object*, const char*>;
+
+    profile::clock::time_point epoch{profile::clock::now()};
+    std::map<key_type, std::size_t> index{};
+    std::map<const sc_core::sc_object*, std::size_t> threads{};
+    std::vector<std::string> thread_names{};
+    std::vector<profile_entry> entries{};
+    std::vector<profile_event> events{};
+    std::string filename{};
+    bool trace{false};
+};
+
+} /* namespace */
+
+static constexpr std::size_t MAX_EVENTS{1u << 20u};
+
+static auto get_data() -> profile_data& {
+    static profile_data g_data{};
+    return g_data;
+}
+
+static auto get_entry(const sc_core::sc_object* owner, const char* name)
+        -> std::size_t {
+    auto& data = get_data();
+    const profile_data::key_type key{owner, name};
+
+    auto it = data.index.find(key);
+
+    if (data.index.end() != it) {
+        return it->second;
+    }
+
+    auto thread = data.threads.find(owner);
+
+    if (data.threads.end() == thread) {
+        thread = data.threads.emplace(owner, data.thread_names.size()).first;
+        data.thread_names.emplace_back((nullptr != owner) ?
+                owner->name() : "");
+    }
+
+    const std::string& owner_name = data.thread_names[thread->second];
+
+    data.entries.push_back({
+        owner_name.empty() ? name : (owner_name + "." + name),
+        thread->second,
+        0u,
+        0u,
+        profile::clock::duration::zero(),
+        profile::clock::duration::zero()
+    });
+
+    data.index.emplace(key, data.entries.size() - 1u);
+
+    return data.entries.size() - 1u;
+}
+
+static auto to_microseconds(profile::clock::duration duration) -> double {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+profile::scope::scope(const sc_core::sc_object* owner, const char* name) :
+    m_owner{owner},
+    m_name{name},
+    m_start{clock::now()}
+{ }
+
+void profile::scope::stop() {
+    if (m_running) {
+        m_running = false;
+        record(m_owner, m_name, m_start, clock::now());
+    }
+}
+
+profile::scope::~scope() {
+    stop();
+}
+
+void profile::enable_trace(const std::string& filename) {
+#if !defined(LOGIC_PROFILE)
+    SC_REPORT_WARNING("logic::profile", ("Built without LOGIC_PROFILE, "
+                "profile trace file " + filename + " is not written").c_str());
+#endif
+
+    auto& data = get_data();
+
+    data.trace = !filename.empty();
+    data.filename = filename;
+}
+
+void profile::count(const sc_core::sc_object* owner, const char* name,
+        std::uint64_t value) {
+    get_data().entries[get_entry(owner, name)].count += value;
+}
+
+void profile::record(const sc_core::sc_object* owner, const char* name,
+        clock::time_point start, clock::time_point end) {
+    auto& data = get_data();
+    const auto index = get_entry(owner, name);
+    auto& entry = data.entries[index];
+    const auto duration = end - start;
+
+    ++entry.calls;
+    entry.total += duration;
+    entry.max = std::max(entry.max, duration);
+
+    if (data.trace) {
+        if (data.events.size() < MAX_EVENTS) {
+            data.events.push_back({index, start, duration});
+        }
+        else if (data.events.size() == MAX_EVENTS) {
+            SC_REPORT_WARNING("logic::profile",
+                    "Too many trace events, rest is not recorded");
+            data.events.push_back({index, start, duration});
+        }
+    }
+}
+
+auto profile::summary() -> std::string {
+    const auto& data = get_data();
+    const auto elapsed = clock::now() - data.epoch;
+
+    std::vector<const profile_entry*> entries;
+    auto attributed = clock::duration::zero();
+
+    for (const auto& entry : data.entries) {
+        entries.push_back(&entry);
+        attributed += entry.total;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+        [] (const profile_entry* lhs, const profile_entry* rhs) {
+            return lhs->total > rhs->total;
+        }
+    );
+
+    const auto percent = [&elapsed] (clock::duration duration) {
+        return (elapsed.count() > 0) ? (100.0 * double(duration.count()) /
+                double(elapsed.count())) : 0.0;
+    };
+
+    std::ostringstream ss;
+
+    ss << std::fixed << std::setprecision(2)
+        << "Profile of " << (to_microseconds(elapsed) / 1000.0) << " ms\n"
+        << std::setw(12) << "time [ms]" << std::setw(8) << "%"
+        << std::setw(12) << "calls" << std::setw(12) << "avg [us]"
+        << std::setw(12) << "max [us]" << std::setw(12) << "count"
+        << "  name\n";
+
+    for (const auto entry : entries) {
+        const auto total = to_microseconds(entry->total);
+
+        ss << std::setw(12) << (total / 1000.0)
+            << std::setw(8) << percent(entry->total)
+            << std::setw(12) << entry->calls
+            << std::setw(12) << (entry->calls ?
+                    (total / double(entry->calls)) : 0.0)
+            << std::setw(12) << to_microseconds(entry->max)
+            << std::setw(12) << entry->count
+            << "  " << entry->name << "\n";
+    }
+
+    const auto unattributed = (elapsed > attributed) ?
+        (elapsed - attributed) : clock::duration::zero();
+
+    ss << std::setw(12) << (to_microseconds(unattributed) / 1000.0)
+        << std::setw(8) << percent(unattributed)
+        << std::setw(12) << "-" << std::setw(12) << "-"
+        << std::setw(12) << "-" << std::setw(12) << "-"
+        << "  (Verilated models, SystemC kernel)\n";
+
+    return ss.str();
+}
+
+void profile::write_trace() {
+    const auto& data = get_data();
+
+    if (!data.trace) {
+        return;
+    }
+
+    const auto filename = logic::get_output_filename(data.filename);
+
+    std::ofstream file{filename, std::ios::trunc};
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+
+    for (std::size_t i = 0u; i < data.thread_names.size(); ++i) {
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << i << ",\"args\":{\"name\":\"" << data.thread_names[i]
+            << "\"}},\n";
+    }
+
+    for (const auto& event : data.events) {
+        const auto& entry = data.entries[event.entry];
+
+        file << "{\"name\":\"" << entry.name
+            << "\",\"cat\":\"logic\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << entry.thread
+            << ",\"ts\":" << to_microseconds(event.start - data.epoch)
+            << ",\"dur\":" << to_microseconds(event.duration) << "},\n";
+    }
+
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+        "\"args\":{\"name\":\"simulation\"}}\n]}\n";
+
+    if (!file) {
+        SC_REPORT_WARNING("logic::profile",
+                ("Cannot write profile trace file " + filename).c_str());
+    }
+}
@@ -0,0 +1,67 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/seed.hpp"
+
+#include <random>
+
+namespace {
+
+struct seed_option {
+    bool enabled{false};
+    std::uint32_t value{0};
+};
+
+} /* namespace */
+
+static auto get_option() noexcept -> seed_option& {
+    static seed_option g_option{};
+    return g_option;
+}
+
+void logic::set_seed(std::uint32_t value) noexcept {
+    auto& option = get_option();
+
+    option.enabled = true;
+    option.value = value;
+}
+
+bool logic::has_seed() noexcept {
+    return get_option().enabled;
+}
+
+auto logic::get_seed(const std::string& scope) -> std::uint32_t {
+    const auto& option = get_option();
+
+    if (!option.enabled) {
+        std::random_device random_device;
+        return random_device();
+    }
+
+    /* FNV-1a hash of scope mixed with the global seed */
+    std::uint32_t hash{2166136261u};
+
+    for (const auto c : scope) {
+        hash ^= std::uint32_t(static_cast<unsigned char>(c));
+        hash *= 16777619u;
+    }
+
+    std::seed_seq sequence{option.value, hash};
+    std::uint32_t seed{0};
+
+    sequence.generate(&seed, &seed + 1);
+
+    return seed;
+}
@@ -0,0 +1,401 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/test_server.hpp"
+#include "logic/json_escape.hpp"
+#include "logic/output_file.hpp"
+#include "logic/seed.hpp"
+
+#include <uvm>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using logic::test_server;
+
+using time_point = std::chrono::steady_clock::time_point;
+
+static auto split(const std::string& str) -> std::vector<std::string> {
+    std::vector<std::string> items;
+    std::istringstream stream{str};
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+static auto to_seed(const std::string& str) -> std::uint32_t {
+    std::size_t pos{0};
+    const auto value = std::stoul(str, &pos);
+
+    if ((pos != str.size()) || (value > 0xFFFFFFFFul)) {
+        throw std::runtime_error(str + " invalid seed");
+    }
+
+    return std::uint32_t(value);
+}
+
+static auto to_seeds(const std::string& str) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> seeds;
+
+    for (const auto& item : split(str)) {
+        const auto pos = item.find(':');
+
+        if (std::string::npos == pos) {
+            seeds.push_back(to_seed(item));
+            continue;
+        }
+
+        const auto first = to_seed(item.substr(0, pos));
+        const auto last = to_seed(item.substr(pos + 1));
+
+        if (first > last) {
+            throw std::runtime_error(item + " invalid seed range");
+        }
+
+        for (auto seed = first; seed != last; ++seed) {
+            seeds.push_back(seed);
+        }
+
+        seeds.push_back(last);
+    }
+
+    return seeds;
+}
+
+static auto escape(const std::string& str) -> std::string {
+    std::string escaped;
+
+    for (const auto c : str) {
+        switch (c) {
+        case '&':
+            escaped += "&amp;";
+            break;
+        case '<':
+            escaped += "&lt;";
+            break;
+        case '>':
+            escaped += "&gt;";
+            break;
+        case '"':
+            escaped += "&quot;";
+            break;
+        default:
+            escaped += c;
+            break;
+        }
+    }
+
+    return escaped;
+}
+
+static auto count_threads() -> std::size_t {
+    std::size_t threads{0};
+    auto directory = ::opendir("/proc/self/task");
+
+    if (nullptr != directory) {
+        while (auto entry = ::readdir(directory)) {
+            if ('.' != entry->d_name[0]) {
+                ++threads;
+            }
+        }
+        ::closedir(directory);
+    }
+
+    return threads;
+}
+
+static auto describe(int status) -> std::string {
+    if (WIFSIGNALED(status)) {
+        return "killed by signal " + std::to_string(WTERMSIG(status));
+    }
+
+    return "exit status " + std::to_string(WEXITSTATUS(status));
+}
+
+test_server::test_server(int argc, char* argv[]) {
+    static const std::string TESTS{"+logic_tests="};
+    static const std::string SEEDS{"+logic_seeds="};
+    static const std::string JOBS{"+logic_jobs="};
+    static const std::string REPORT{"+logic_report="};
+
+    if ((argc > 0) && (nullptr != argv)) {
+        m_executable = argv[0];
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+
+        if (0 == arg.compare(0, TESTS.size(), TESTS)) {
+            m_tests = split(arg.substr(TESTS.size()));
+        }
+        else if (0 == arg.compare(0, SEEDS.size(), SEEDS)) {
+            m_seeds = to_seeds(arg.substr(SEEDS.size()));
+        }
+        else if (0 == arg.compare(0, JOBS.size(), JOBS)) {
+            m_jobs = std::stoul(arg.substr(JOBS.size()));
+        }
+        else if (0 == arg.compare(0, REPORT.size(), REPORT)) {
+            m_report = arg.substr(REPORT.size());
+        }
+    }
+
+    if (m_seeds.empty()) {
+        std::random_device random_device;
+        m_seeds.push_back(random_device());
+    }
+
+    if (0 == m_jobs) {
+        m_jobs = std::thread::hardware_concurrency();
+    }
+
+    if (0 == m_jobs) {
+        m_jobs = 1;
+    }
+}
+
+bool test_server::enabled() const noexcept {
+    return !m_tests.empty();
+}
+
+int test_server::run(const test_type& test) {
+    if (!enabled()) {
+        return test() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (count_threads() > 1) {
+        SC_REPORT_WARNING("logic::test_server", "Process has more threads, "
+                "forked tests may hang, use single threaded models");
+    }
+
+    std::vector<job> jobs;
+
+    for (const auto& name : m_tests) {
+        for (const auto seed : m_seeds) {
+            jobs.push_back({name, seed, name + "_" + std::to_string(seed),
+                    0, false, 0.0});
+        }
+    }
+
+    std::cout.flush();
+    std::fflush(nullptr);
+
+    std::map<pid_t, std::pair<std::size_t, time_point>> running;
+    std::size_t next{0};
+
+    while ((next < jobs.size()) || !running.empty()) {
+        while ((next < jobs.size()) && (running.size() < m_jobs)) {
+            const auto& item = jobs[next];
+            const pid_t pid = ::fork();
+
+            if (pid < 0) {
+                throw std::runtime_error("Cannot fork test " + item.name);
+            }
+
+            if (0 == pid) {
+                const std::string log{item.name + ".log"};
+                const int fd = ::open(log.c_str(),
+                        O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+                if (fd >= 0) {
+                    ::dup2(fd, STDOUT_FILENO);
+                    ::dup2(fd, STDERR_FILENO);
+                    ::close(fd);
+                }
+
+                bool passed{false};
+
+                try {
+                    logic::set_seed(item.seed);
+                    logic::set_output_suffix(item.name);
+                    uvm::uvm_set_config_string("*", "trace_filename",
+                            item.name);
+                    uvm::uvm_factory::get()->create_component_by_name(
+                            item.test, "", "uvm_test_top");
+
+                    passed = test();
+                }
+                catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                }
+                catch (...) { }
+
+                std::cout.flush();
+                std::cerr.flush();
+                std::fflush(nullptr);
+                std::_Exit(passed ? EXIT_SUCCESS : EXIT_FAILURE);
+            }
+
+            running.emplace(pid, std::make_pair(next++,
+                        std::chrono::steady_clock::now()));
+        }
+
+        int status{0};
+        const pid_t pid = ::waitpid(-1, &status, 0);
+
+        if (pid < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            throw std::runtime_error("Cannot wait for forked tests");
+        }
+
+        auto it = running.find(pid);
+
+        if (running.end() == it) {
+            continue;
+        }
+
+        const std::chrono::duration<double> elapsed{
+            std::chrono::steady_clock::now() - it->second.second};
+
+        auto& item = jobs[it->second.first];
+
+        item.status = status;
+        item.passed = WIFEXITED(status) && (0 == WEXITSTATUS(status));
+        item.time = elapsed.count();
+
+        std::cout << (item.passed ? "PASSED " : "FAILED ") << item.test
+            << " seed " << item.seed << " (" << item.time << " s";
+
+        if (!item.passed) {
+            std::cout << ", " << describe(status) << ", see " << item.name
+                << ".log";
+        }
+
+        std::cout << ")" << std::endl;
+
+        running.erase(it);
+    }
+
+    std::size_t failed{0};
+
+    for (const auto& item : jobs) {
+        if (!item.passed) {
+            ++failed;
+        }
+    }
+
+    std::cout << "Tests " << jobs.size() << ", passed "
+        << (jobs.size() - failed) << ", failed " << failed << std::endl;
+
+    if (!m_report.empty()) {
+        const auto extension = m_report.rfind('.');
+
+        if ((std::string::npos != extension) &&
+                (".json" == m_report.substr(extension))) {
+            write_json(jobs);
+        }
+        else {
+            write_junit(jobs);
+        }
+    }
+
+    return (0 == failed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void test_server::write_junit(const std::vector<job>& jobs) const {
+    std::size_t failures{0};
+    std::size_t errors{0};
+    double time{0.0};
+
+    for (const auto& item : jobs) {
+        if (WIFSIGNALED(item.status)) {
+            ++errors;
+        }
+        else if (!item.passed) {
+            ++failures;
+        }
+        time += item.time;
+    }
+
+    std::ofstream file{m_report, std::ios::trunc};
+
+    file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<testsuite name=\"" << escape(m_executable)
+        << "\" tests=\"" << jobs.size()
+        << "\" failures=\"" << failures
+        << "\" errors=\"" << errors
+        << "\" time=\"" << time << "\">\n";
+
+    for (const auto& item : jobs) {
+        file << "  <testcase classname=\"" << escape(item.test)
+            << "\" name=\"" << escape(item.name)
+            << "\" time=\"" << item.time << "\"";
+
+        if (item.passed) {
+            file << "/>\n";
+            continue;
+        }
+
+        file << ">\n    <" << (WIFSIGNALED(item.status) ? "error" : "failure")
+            << " message=\"" << describe(item.status) << "\">"
+            << escape(item.name) << ".log</"
+            << (WIFSIGNALED(item.status) ? "error" : "failure")
+            << ">\n  </testcase>\n";
+    }
+
+    file << "</testsuite>\n";
+
+    if (!file) {
+        throw std::runtime_error("Cannot write report " + m_report);
+    }
+}
+
+void test_server::write_json(const std::vector<job>& jobs) const {
+    std::ofstream file{m_report, std::ios::trunc};
+
+    file << "{\"executable\":\"" << logic::escape_json(m_executable)
+        << "\",\"tests\":[\n";
+
+    for (std::size_t i = 0u; i < jobs.size(); ++i) {
+        const auto& item = jobs[i];
+
+        file << "  {\"test\":\"" << logic::escape_json(item.test)
+            << "\",\"seed\":" << item.seed
+            << ",\"passed\":" << (item.passed ? "true" : "false")
+            << ",\"status\":\"" << describe(item.status)
+            << "\",\"time\":" << item.time
+            << ",\"log\":\"" << logic::escape_json(item.name) << ".log\"}"
+            << ((i + 1u) < jobs.size() ? ",\n" : "\n");
+    }
+
+    file << "]}\n";
+
+    if (!file) {
+        throw std::runtime_error("Cannot write report " + m_report);
+    }
+}
@@ -15,6 +15,263 @@
 
 #include "logic/trace_base.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+
 using logic::trace_base;
 
-trace_base::~trace_base() = default;
+namespace {
+
+struct time_option {
+    bool enabled;
+    double value;
+    sc_core::sc_time_unit unit;
+
+    sc_core::sc_time get() const {
+        return sc_core::sc_time{value, unit};
+    }
+};
+
+struct trace_options {
+    trace_base::format_t format;
+    time_option start;
+    time_option stop;
+    time_option ring;
+};
+
+using time_unit = std::pair<const char*, sc_core::sc_time_unit>;
+
+const std::array<time_unit, 6> g_time_units{{
+    {"fs", sc_core::SC_FS},
+    {"ps", sc_core::SC_PS},
+    {"ns", sc_core::SC_NS},
+    {"us", sc_core::SC_US},
+    {"ms", sc_core::SC_MS},
+    {"s",  sc_core::SC_SEC}
+}};
+
+} /* namespace */
+
+static auto get_options() noexcept -> trace_options& {
+    static trace_options options{
+        trace_base::VCD,
+        {false, 0.0, sc_core::SC_NS},
+        {false, 0.0, sc_core::SC_NS},
+        {false, 0.0, sc_core::SC_NS}
+    };
+    return options;
+}
+
+static auto get_traces() -> std::vector<trace_base*>& {
+    static std::vector<trace_base*> traces;
+    return traces;
+}
+
+static auto to_time_option(const std::string& time) -> time_option {
+    std::size_t position{0};
+    double value{0.0};
+
+    try {
+        value = std::stod(time, &position);
+    }
+    catch (const std::exception&) {
+        throw std::runtime_error(time + " invalid trace time");
+    }
+
+    while ((position < time.size()) && (' ' == time[position])) {
+        ++position;
+    }
+
+    const auto unit = time.substr(position);
+
+    auto it = std::find_if(g_time_units.cbegin(), g_time_units.cend(),
+        [&unit] (const time_unit& item) {
+            return (unit == item.first);
+        }
+    );
+
+    if ((g_time_units.cend() == it) || (value < 0.0)) {
+        throw std::runtime_error(time + " invalid trace time");
+    }
+
+    return {true, value, it->second};
+}
+
+static bool has_extension(const std::string& filename,
+        const std::string& extension) noexcept {
+    return (filename.size() > extension.size()) && (0 == filename.compare(
+            filename.size() - extension.size(), extension.size(), extension));
+}
+
+trace_base::trace_base() {
+    get_traces().push_back(this);
+}
+
+trace_base::~trace_base() {
+    auto& traces = get_traces();
+
+    traces.erase(std::remove(traces.begin(), traces.end(), this),
+            traces.end());
+
+    if (get_options().ring.enabled && !m_triggered) {
+        for (const auto& segment : m_segments) {
+            std::remove(segment.c_str());
+        }
+    }
+}
+
+void trace_base::set_format(format_t format) noexcept {
+    get_options().format = format;
+}
+
+void trace_base::set_format(const std::string& name) {
+    if ("vcd" == name) {
+        get_options().format = VCD;
+    }
+    else if ("fst" == name) {
+        get_options().format = FST;
+    }
+    else {
+        throw std::runtime_error(name + " invalid trace format");
+    }
+}
+
+void trace_base::set_start(const std::string& time) {
+    get_options().start = to_time_option(time);
+}
+
+void trace_base::set_stop(const std::string& time) {
+    get_options().stop = to_time_option(time);
+}
+
+void trace_base::set_ring(const std::string& time) {
+    get_options().ring = to_time_option(time);
+}
+
+void trace_base::trigger() {
+    for (auto trace : get_traces()) {
+        if (!trace->m_triggered) {
+            trace->m_triggered = true;
+            trace->m_trigger.notify(sc_core::SC_ZERO_TIME);
+        }
+    }
+}
+
+auto trace_base::get_format(
+        const std::string& filename) noexcept -> format_t {
+    if (has_extension(filename, ".fst")) {
+        return FST;
+    }
+
+    if (has_extension(filename, ".vcd")) {
+        return VCD;
+    }
+
+    return get_options().format;
+}
+
+auto trace_base::get_stem(const std::string& filename) -> std::string {
+    if (has_extension(filename, ".fst") || has_extension(filename, ".vcd")) {
+        return filename.substr(0, filename.size() - 4);
+    }
+
+    return filename;
+}
+
+bool trace_base::is_windowed() noexcept {
+    const auto& options = get_options();
+
+    return options.start.enabled || options.stop.enabled ||
+        options.ring.enabled;
+}
+
+auto trace_base::extension() const noexcept -> const char* {
+    return ".vcd";
+}
+
+void trace_base::open(const std::string& /* filename */) { }
+
+void trace_base::close() { }
+
+void trace_base::run(const std::string& stem) {
+    m_stem = stem;
+
+    if (!is_windowed()) {
+        open_segment();
+        return;
+    }
+
+    sc_core::sc_spawn(sc_bind(&trace_base::control, this),
+            sc_core::sc_gen_unique_name("logic_trace"));
+}
+
+void trace_base::control() {
+    const auto& options = get_options();
+
+    const auto stop = options.stop.enabled ?
+        options.stop.get() : sc_core::sc_max_time();
+
+    const auto ring = options.ring.enabled ?
+        options.ring.get() : sc_core::SC_ZERO_TIME;
+
+    if (options.start.enabled) {
+        const auto start = options.start.get();
+
+        if (start > sc_core::sc_time_stamp()) {
+            sc_core::wait(start - sc_core::sc_time_stamp(), m_trigger);
+        }
+    }
+
+    open_segment();
+
+    while (sc_core::sc_time_stamp() < stop) {
+        const auto remaining = stop - sc_core::sc_time_stamp();
+
+        if (sc_core::SC_ZERO_TIME == ring) {
+            sc_core::wait(remaining);
+        }
+        else if (m_triggered) {
+            sc_core::wait(std::min(ring, remaining));
+            break;
+        }
+        else {
+            sc_core::wait(std::min(ring, remaining), m_trigger);
+
+            if (!m_triggered && (sc_core::sc_time_stamp() < stop)) {
+                close_segment();
+                open_segment();
+            }
+        }
+    }
+
+    close_segment();
+}
+
+void trace_base::open_segment() {
+    std::string filename{m_stem};
+
+    if (get_options().ring.enabled) {
+        filename += "_" + std::to_string(m_index++);
+    }
+
+    filename += extension();
+
+    if (get_options().ring.enabled && (m_segments.size() >= 2)) {
+        std::remove(m_segments.front().c_str());
+        m_segments.erase(m_segments.begin());
+    }
+
+    m_segments.push_back(filename);
+    open(filename);
+    m_opened = true;
+}
+
+void trace_base::close_segment() {
+    if (m_opened) {
+        close();
+        m_opened = false;
+    }
+}
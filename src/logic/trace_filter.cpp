@@ -0,0 +1,199 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/trace_filter.hpp"
+
+#include <uvm>
+
+#include <algorithm>
+#include <stdexcept>
+
+using logic::trace_filter;
+
+static bool glob(const char* pattern, const char* name) noexcept {
+    const char* star_pattern{nullptr};
+    const char* star_name{nullptr};
+
+    while ('\0' != *name) {
+        if (('?' == *pattern) || (*pattern == *name)) {
+            ++pattern;
+            ++name;
+        }
+        else if ('*' == *pattern) {
+            star_pattern = pattern++;
+            star_name = name;
+        }
+        else if (nullptr != star_pattern) {
+            pattern = star_pattern + 1;
+            name = ++star_name;
+        }
+        else {
+            return false;
+        }
+    }
+
+    while ('*' == *pattern) {
+        ++pattern;
+    }
+
+    return ('\0' == *pattern);
+}
+
+static auto split(const std::string& list) -> std::vector<std::string> {
+    std::vector<std::string> items;
+    std::string::size_type begin{0};
+
+    while (begin <= list.size()) {
+        auto end = list.find(',', begin);
+
+        if (std::string::npos == end) {
+            end = list.size();
+        }
+
+        auto item = list.substr(begin, end - begin);
+
+        const auto first = item.find_first_not_of(' ');
+        const auto last = item.find_last_not_of(' ');
+
+        if (std::string::npos != first) {
+            items.push_back(item.substr(first, last - first + 1));
+        }
+
+        begin = end + 1;
+    }
+
+    return items;
+}
+
+trace_filter::trace_filter(const std::vector<std::string>& includes,
+        const std::vector<std::string>& excludes) {
+    for (const auto& text : includes) {
+        include(text);
+    }
+
+    for (const auto& text : excludes) {
+        exclude(text);
+    }
+}
+
+auto trace_filter::include(const std::string& text) -> trace_filter& {
+    m_includes.push_back(compile(text));
+    return *this;
+}
+
+auto trace_filter::exclude(const std::string& text) -> trace_filter& {
+    m_excludes.push_back(compile(text));
+    return *this;
+}
+
+auto trace_filter::configure() -> trace_filter& {
+    std::string list;
+
+    if (uvm::uvm_config_db<std::string>::get(nullptr, "*", "trace_include",
+                list)) {
+        for (const auto& text : split(list)) {
+            include(text);
+        }
+    }
+
+    list.clear();
+
+    if (uvm::uvm_config_db<std::string>::get(nullptr, "*", "trace_exclude",
+                list)) {
+        for (const auto& text : split(list)) {
+            exclude(text);
+        }
+    }
+
+    return *this;
+}
+
+bool trace_filter::empty() const noexcept {
+    return m_includes.empty() && m_excludes.empty();
+}
+
+bool trace_filter::exact() const noexcept {
+    return m_excludes.empty() && std::none_of(m_includes.cbegin(),
+        m_includes.cend(), [] (const pattern& item) {
+            return item.is_regex ||
+                (std::string::npos != item.text.find_first_of("*?"));
+        }
+    );
+}
+
+bool trace_filter::selected(const std::string& name) const {
+    return (m_includes.empty() || match(m_includes, name)) &&
+        !match(m_excludes, name);
+}
+
+bool trace_filter::excluded(const std::string& name) const {
+    return match(m_excludes, name);
+}
+
+auto trace_filter::scopes() const -> std::vector<std::string> {
+    std::vector<std::string> prefixes;
+
+    for (const auto& item : m_includes) {
+        if (item.is_regex) {
+            return {};
+        }
+
+        const auto prefix = item.text.substr(0,
+                item.text.find_first_of("*?"));
+
+        if (prefix.empty()) {
+            return {};
+        }
+
+        prefixes.push_back(prefix);
+    }
+
+    return prefixes;
+}
+
+auto trace_filter::compile(const std::string& text) -> pattern {
+    if (0 == text.compare(0, 3, "re:")) {
+        try {
+            return {text.substr(3), true, std::regex{text.substr(3)}};
+        }
+        catch (const std::regex_error&) {
+            throw std::runtime_error(text + " invalid trace pattern");
+        }
+    }
+
+    return {text, false, std::regex{}};
+}
+
+bool trace_filter::match(const std::vector<pattern>& patterns,
+        const std::string& name) {
+    for (const auto& item : patterns) {
+        std::string::size_type position{0};
+
+        do {
+            position = name.find('.', position + 1);
+
+            if (item.match(name.substr(0, position))) {
+                return true;
+            }
+        } while (std::string::npos != position);
+    }
+
+    return false;
+}
+
+bool trace_filter::pattern::match(const std::string& name) const {
+    return is_regex ? std::regex_match(name, regex) :
+        glob(text.c_str(), name.c_str());
+}
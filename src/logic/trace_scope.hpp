@@ -0,0 +1,68 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TRACE_SCOPE_HPP
+#define TRACE_SCOPE_HPP
+
+#include "logic/trace_filter.hpp"
+
+#include <systemc>
+
+#include <string>
+
+namespace logic {
+
+template<typename T>
+auto trace_dumpvars(T& trace_file, const std::string& scope, int)
+        -> decltype(trace_file.dumpvars(0, scope), bool()) {
+    trace_file.dumpvars(0, scope);
+    return true;
+}
+
+template<typename T>
+bool trace_dumpvars(T& /* trace_file */,
+        const std::string& /* scope */, long) {
+    return false;
+}
+
+/* Function: trace_scope
+ *
+ * Limits Verilated trace file to scopes selected by filter. Verilator
+ * selects scopes only by hierarchical name prefixes, wildcards are cut off
+ * and exclude and regex patterns apply to SystemC objects only.
+ */
+template<typename T>
+void trace_scope(T& trace_file, const trace_filter& filter,
+        const std::string& name) {
+    if (filter.empty()) {
+        return;
+    }
+
+    if (!filter.exact()) {
+        SC_REPORT_WARNING("logic::trace", ("Model " + name +
+                    " is filtered only by include name prefixes").c_str());
+    }
+
+    for (const auto& scope : filter.scopes()) {
+        if (!trace_dumpvars(trace_file, scope, 0)) {
+            SC_REPORT_WARNING("logic::trace", ("Model " + name +
+                        " does not support trace scopes").c_str());
+            return;
+        }
+    }
+}
+
+} /* namespace logic */
+
+#endif /* TRACE_SCOPE_HPP */
@@ -18,6 +18,7 @@
 #include <systemc>
 #include <type_traits>
 
+using logic::trace_filter;
 using logic::trace_systemc;
 
 using sc_dt::sc_bv;
@@ -86,21 +87,40 @@ static void trace(sc_trace_file* trace_file, const sc_object* object) {
 }
 
 static void trace(sc_trace_file* trace_file, const sc_object* parent,
-        std::size_t level) {
+        std::size_t level, const logic::trace_filter& filter) {
     if ((parent != nullptr) && (0 != level--)) {
         for (const auto& object : parent->get_child_objects()) {
-            trace(trace_file, object);
-            trace(trace_file, object, level);
+            if (filter.excluded(object->name())) {
+                continue;
+            }
+
+            if (filter.selected(object->name())) {
+                trace(trace_file, object);
+            }
+
+            trace(trace_file, object, level, filter);
         }
     }
 }
 
 trace_systemc::trace_systemc(const sc_object& object,
-        const std::string& filename, std::size_t level) :
-    m_trace_file{sc_core::sc_create_vcd_trace_file(
-            filename.empty() ? object.basename() : filename.c_str())}
+        const std::string& filename, std::size_t level,
+        const trace_filter& filter) :
+    m_trace_file{sc_core::sc_create_vcd_trace_file(get_stem(
+            filename.empty() ? object.basename() : filename).c_str())}
 {
-    trace(m_trace_file, &object, level);
+    if (FST == get_format(filename)) {
+        SC_REPORT_WARNING("logic::trace", (std::string{"SystemC module "} +
+                    object.basename() + " supports only VCD tracing").c_str());
+    }
+
+    if (is_windowed()) {
+        SC_REPORT_WARNING("logic::trace", (std::string{"SystemC module "} +
+                    object.basename() + " is traced for whole simulation"
+                    ).c_str());
+    }
+
+    trace(m_trace_file, &object, level, trace_filter{filter}.configure());
 }
 
 trace_systemc::~trace_systemc() {
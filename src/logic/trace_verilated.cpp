@@ -15,19 +15,29 @@
 
 #include "logic/trace_verilated.hpp"
 
+#include "trace_scope.hpp"
+
 #include <verilated.h>
 #include <verilated_cov.h>
 #include <verilated_vcd_c.h>
 #include <verilated_vcd_sc.h>
 
+using logic::trace_filter;
 using logic::trace_verilated;
 
 trace_verilated::trace_verilated(const std::string& name,
-        const std::string& filename) :
+        const std::string& filename, const trace_filter& filter) :
     m_trace_file{new VerilatedVcdSc},
-    m_filename{filename.empty() ? name : filename}
+    m_filename{get_stem(filename.empty() ? name : filename)}
 {
+    if (FST == get_format(filename)) {
+        SC_REPORT_WARNING("logic::trace", ("Model " + name +
+                    " was verilated with VCD tracing, using VCD").c_str());
+    }
+
     Verilated::traceEverOn(true);
+
+    logic::trace_scope(*m_trace_file, trace_filter{filter}.configure(), name);
 }
 
 trace_verilated::~trace_verilated() {
@@ -42,6 +52,14 @@ auto trace_verilated::get(
     return verilated_vcd;
 }
 
-void trace_verilated::open() {
-    m_trace_file->open((m_filename + ".vcd").c_str());
+auto trace_verilated::extension() const noexcept -> const char* {
+    return ".vcd";
+}
+
+void trace_verilated::open(const std::string& filename) {
+    m_trace_file->open(filename.c_str());
+}
+
+void trace_verilated::close() {
+    m_trace_file->close();
 }
@@ -0,0 +1,65 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/trace_verilated_fst.hpp"
+
+#include "trace_scope.hpp"
+
+#include <verilated.h>
+#include <verilated_cov.h>
+#include <verilated_fst_c.h>
+#include <verilated_fst_sc.h>
+
+using logic::trace_filter;
+using logic::trace_verilated_fst;
+
+trace_verilated_fst::trace_verilated_fst(const std::string& name,
+        const std::string& filename, const trace_filter& filter) :
+    m_trace_file{new VerilatedFstSc},
+    m_filename{get_stem(filename.empty() ? name : filename)}
+{
+    if ((get_stem(filename) != filename) && (VCD == get_format(filename))) {
+        SC_REPORT_WARNING("logic::trace", ("Model " + name +
+                    " was verilated with FST tracing, using FST").c_str());
+    }
+
+    Verilated::traceEverOn(true);
+
+    logic::trace_scope(*m_trace_file, trace_filter{filter}.configure(), name);
+}
+
+trace_verilated_fst::~trace_verilated_fst() {
+        m_trace_file->close();
+        Verilated::traceEverOn(false);
+        delete m_trace_file;
+        VerilatedCov::write((m_filename + ".coverage").c_str());
+}
+
+auto trace_verilated_fst::get(
+        VerilatedFstSc* verilated_fst) const noexcept -> VerilatedFstC* {
+    return verilated_fst;
+}
+
+auto trace_verilated_fst::extension() const noexcept -> const char* {
+    return ".fst";
+}
+
+void trace_verilated_fst::open(const std::string& filename) {
+    m_trace_file->open(filename.c_str());
+}
+
+void trace_verilated_fst::close() {
+    m_trace_file->close();
+}
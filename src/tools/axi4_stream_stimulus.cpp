@@ -0,0 +1,155 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/range.hpp>
+#include <logic/axi4/stream/stimulus.hpp>
+#include <logic/axi4/stream/rx_sequence_item.hpp>
+
+#include <systemc>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+/*
+ * Usage:
+ *  logic-axi4-stream-stimulus --output=<file> [--packets=<min>[:<max>]]
+ *      [--length=<min>[:<max>]] [--idle=<min>[:<max>]] [--seed=<value>]
+ *      [--tid-width=<bits>] [--tdest-width=<bits>]
+ */
+
+namespace {
+
+struct options {
+    std::string output{};
+    logic::range packets{16, 16};
+    logic::range length{1, 1024};
+    logic::range idle{0, 0};
+    std::size_t seed{0};
+    std::size_t tid_width{1};
+    std::size_t tdest_width{1};
+};
+
+auto to_range(const std::string& arg) -> logic::range {
+    auto pos = arg.find(':');
+
+    if (pos == std::string::npos) {
+        return logic::range{std::stoul(arg)};
+    }
+
+    return {std::stoul(arg.substr(0, pos)), std::stoul(arg.substr(pos + 1))};
+}
+
+auto parse(int argc, char* argv[]) -> options {
+    options result{};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto pos = arg.find('=');
+
+        if (pos == std::string::npos) {
+            throw std::runtime_error(arg + " invalid format");
+        }
+
+        const auto name = arg.substr(0, pos);
+        const auto value = arg.substr(pos + 1);
+
+        if ("--output" == name) {
+            result.output = value;
+        }
+        else if ("--packets" == name) {
+            result.packets = to_range(value);
+        }
+        else if ("--length" == name) {
+            result.length = to_range(value);
+        }
+        else if ("--idle" == name) {
+            result.idle = to_range(value);
+        }
+        else if ("--seed" == name) {
+            result.seed = std::stoul(value);
+        }
+        else if ("--tid-width" == name) {
+            result.tid_width = std::stoul(value);
+        }
+        else if ("--tdest-width" == name) {
+            result.tdest_width = std::stoul(value);
+        }
+        else {
+            throw std::runtime_error(arg + " unknown option");
+        }
+    }
+
+    if (result.output.empty()) {
+        throw std::runtime_error("--output option is required");
+    }
+
+    return result;
+}
+
+void generate(const options& opts) {
+    std::mt19937 random_generator(
+            static_cast<std::mt19937::result_type>(opts.seed));
+
+    std::uniform_int_distribution<std::size_t> random_packets{
+        opts.packets.min(), opts.packets.max()};
+
+    std::uniform_int_distribution<std::size_t> random_length{
+        opts.length.min(), opts.length.max()};
+
+    std::uniform_int_distribution<unsigned> random_data{0, 0xFF};
+
+    logic::axi4::stream::stimulus_writer writer{opts.output};
+    logic::axi4::stream::rx_sequence_item item{"rx_sequence_item"};
+
+    item.idle = opts.idle;
+    item.tid.resize(opts.tid_width);
+    item.tdest.resize(opts.tdest_width);
+
+    const auto packets = random_packets(random_generator);
+
+    for (std::size_t i = 0; i < packets; ++i) {
+        item.tdata.resize(random_length(random_generator));
+
+        for (auto& data : item.tdata) {
+            data = std::uint8_t(random_data(random_generator));
+        }
+
+        writer.write(item);
+    }
+
+    writer.close();
+
+    std::cout << opts.output << ": " << writer.packets() << " packets, " <<
+        writer.records() << " records" << std::endl;
+}
+
+} /* namespace */
+
+int sc_main(int argc, char* argv[]) {
+    try {
+        generate(parse(argc, argv));
+    }
+    catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/axi4/stream/packet.hpp>
+#include <logic/axi4/stream/recorder.hpp>
+
+#include <systemc>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+/*
+ * Usage:
+ *  logic-axi4-stream-tlog [--payload] <file>...
+ *
+ * Prints one line per recorded packet: index, time of the first and the last
+ * transfer, tid, tdest, number of transfers and number of tdata bytes. Fails
+ * when the number of read records differs from the one in the file header.
+ */
+
+namespace {
+
+void dump(const std::string& filename, bool payload) {
+    logic::axi4::stream::record_reader reader{filename};
+    logic::axi4::stream::packet value{"packet"};
+
+    std::size_t index{0};
+
+    std::cout << filename << ": " << reader.records() << " records" <<
+        std::endl;
+
+    while (reader.read(value)) {
+        std::cout << index++;
+
+        if (!value.timestamps.empty()) {
+            std::cout << " " << value.timestamps.front().to_string() <<
+                " " << value.timestamps.back().to_string();
+        }
+
+        std::cout << " tid=0x" << std::hex << value.tid.value() <<
+            " tdest=0x" << value.tdest.value() << std::dec <<
+            " transfers=" << value.timestamps.size() <<
+            " bytes=" << value.tdata.size();
+
+        if (payload) {
+            std::cout << " tdata=" << std::hex << std::setfill('0');
+
+            for (const auto& tdata : value.tdata) {
+                std::cout << std::setw(2) << unsigned(tdata.data());
+            }
+
+            std::cout << std::dec << std::setfill(' ');
+        }
+
+        std::cout << '\n';
+    }
+
+    if ((0 != reader.records()) && (index != reader.records())) {
+        throw std::runtime_error("Transaction log " + filename + " has " +
+                std::to_string(index) + " records, header says " +
+                std::to_string(reader.records()));
+    }
+}
+
+} /* namespace */
+
+int sc_main(int argc, char* argv[]) {
+    bool payload{false};
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg{argv[i]};
+
+            if ("--payload" == arg) {
+                payload = true;
+            }
+            else {
+                dump(arg, payload);
+            }
+        }
+    }
+    catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
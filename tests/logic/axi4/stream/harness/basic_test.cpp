@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "logic/seed.hpp"
 #include "logic/axi4/stream/test.hpp"
 
 #include <random>
@@ -38,8 +39,7 @@ protected:
     void run_phase(uvm::uvm_phase& phase) override {
         phase.raise_objection(this);
 
-        std::random_device random_device;
-        std::mt19937 random_generator(random_device());
+        std::mt19937 random_generator(logic::get_seed(get_full_name()));
 
         std::uniform_int_distribution<std::size_t> random_packets{1, 8};
         std::uniform_int_distribution<std::size_t> random_length{1, 256};
@@ -0,0 +1,147 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/seed.hpp"
+#include "logic/axi4/stream/test.hpp"
+#include "logic/axi4/stream/coverage.hpp"
+#include "logic/axi4/stream/bus_if_base.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace {
+
+class coverage_test : public logic::axi4::stream::test {
+public:
+    UVM_COMPONENT_UTILS(coverage_test)
+
+    using coverage_type = logic::axi4::stream::coverage;
+
+    static constexpr std::size_t PACKETS{8};
+
+    static constexpr std::size_t MAX_ROUNDS{256};
+
+    static constexpr std::size_t MAX_LENGTH_LOG2{10};
+
+    using logic::axi4::stream::test::test;
+
+    coverage_test(coverage_test&&) = delete;
+
+    coverage_test(const coverage_test&) = delete;
+
+    coverage_test& operator=(coverage_test&&) = delete;
+
+    coverage_test& operator=(const coverage_test&) = delete;
+
+    ~coverage_test() override = default;
+protected:
+    void build_phase(uvm::uvm_phase& phase) override {
+        logic::axi4::stream::test::build_phase(phase);
+
+        uvm::uvm_config_db<bool>::set(this, "testbench.tx_agent.*",
+                "coverage_enable", true);
+
+        uvm::uvm_config_db<coverage_type*>::set(this, "testbench.tx_agent.*",
+                "coverage", &m_coverage);
+    }
+
+    void run_phase(uvm::uvm_phase& phase) override {
+        phase.raise_objection(this);
+
+        logic::axi4::stream::bus_if_base* vif{nullptr};
+
+        uvm::uvm_config_db<logic::axi4::stream::bus_if_base*>::get(this,
+                "testbench.tx_agent.monitor", "vif", vif);
+
+        const std::size_t bus_size = ((nullptr != vif) && (vif->size() > 0)) ?
+            vif->size() : 1;
+        const std::size_t max_length = std::size_t(1) << MAX_LENGTH_LOG2;
+        const std::size_t max_beats = (max_length + bus_size - 1) / bus_size;
+
+        m_coverage.require(coverage_type::PACKET_LENGTH, 1,
+                coverage_type::bin(max_length));
+        m_coverage.require(coverage_type::BEAT_COUNT, 1,
+                coverage_type::bin(max_beats));
+        m_coverage.require(coverage_type::LAST_TKEEP, 1, bus_size);
+        m_coverage.require(coverage_type::GAP, 0, 1);
+        m_coverage.require(coverage_type::BACKPRESSURE, 1, 2);
+
+        std::mt19937 random_generator(logic::get_seed(get_full_name()));
+
+        std::uniform_int_distribution<std::size_t> random_log2{0,
+            MAX_LENGTH_LOG2};
+        std::uniform_int_distribution<std::size_t> random_idle{0, 1};
+        std::uniform_int_distribution<unsigned> random_data{0, 0xFF};
+
+        m_sequence->reset->items.resize(1);
+        m_sequence->reset->items[0].duration = 1;
+        m_sequence->reset->items[0].idle = 0;
+
+        /* Packet lengths are log-uniform to hit all packet length bins */
+        auto random_length = [&] () -> std::size_t {
+            const auto low = std::size_t(1) << random_log2(random_generator);
+
+            std::uniform_int_distribution<std::size_t> random{low,
+                std::min(2 * low - 1, max_length)};
+
+            return random(random_generator);
+        };
+
+        std::size_t rounds = 0;
+
+        for (; (rounds < MAX_ROUNDS) && !m_coverage.covered(); ++rounds) {
+            const logic::range rx_idle{0, 3 * random_idle(random_generator)};
+            const logic::range tx_idle{0, 3 * random_idle(random_generator)};
+
+            m_sequence->rx->items.resize(PACKETS);
+            m_sequence->tx->items.resize(PACKETS);
+
+            for (auto& item : m_sequence->rx->items) {
+                item.idle = rx_idle;
+                item.tdata.resize(random_length());
+                for (auto& data : item.tdata) {
+                    data = std::uint8_t(random_data(random_generator));
+                }
+            }
+
+            for (auto& item : m_sequence->tx->items) {
+                item.idle = tx_idle;
+            }
+
+            m_sequence->start(m_testbench->sequencer);
+
+            const auto percent = unsigned(100.0 * m_coverage.ratio());
+
+            UVM_INFO(get_name(), "Round " + std::to_string(rounds + 1) +
+                    ": " + std::to_string(percent) + "%", uvm::UVM_MEDIUM);
+        }
+
+        if (m_coverage.covered()) {
+            UVM_INFO(get_name(), "Coverage goal met after " +
+                    std::to_string(rounds) + " rounds", uvm::UVM_LOW);
+        }
+        else {
+            UVM_ERROR(get_name(), "Coverage goal not met after " +
+                    std::to_string(rounds) + " rounds");
+        }
+
+        phase.drop_objection(this);
+    }
+
+    coverage_type m_coverage{};
+};
+
+} /* namespace */
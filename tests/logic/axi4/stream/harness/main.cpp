@@ -0,0 +1,52 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_MODEL
+#error "LOGIC_MODEL must be defined with Verilated model name"
+#endif
+
+#define LOGIC_STRINGIFY(x) #x
+#define LOGIC_MODEL_NAME(x) LOGIC_STRINGIFY(x)
+#define LOGIC_MODEL_HEADER(x) LOGIC_STRINGIFY(x.h)
+
+#include LOGIC_MODEL_HEADER(LOGIC_MODEL)
+
+#include <logic/axi4/stream/harness.hpp>
+
+#ifndef TDATA_BYTES
+#define TDATA_BYTES 4
+#endif
+
+#ifndef TUSER_WIDTH
+#define TUSER_WIDTH 1
+#endif
+
+#ifndef TDEST_WIDTH
+#define TDEST_WIDTH 1
+#endif
+
+#ifndef TID_WIDTH
+#define TID_WIDTH 1
+#endif
+
+int sc_main(int argc, char* argv[]) {
+    return logic::axi4::stream::harness<
+            LOGIC_MODEL,
+            TDATA_BYTES,
+            TID_WIDTH,
+            TDEST_WIDTH,
+            TUSER_WIDTH
+        >::main(LOGIC_MODEL_NAME(LOGIC_MODEL), argc, argv);
+}
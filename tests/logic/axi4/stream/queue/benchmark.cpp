@@ -0,0 +1,160 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_MODEL
+#error "LOGIC_MODEL must be defined with Verilated model name"
+#endif
+
+#define LOGIC_STRINGIFY(x) #x
+#define LOGIC_MODEL_NAME(x) LOGIC_STRINGIFY(x)
+#define LOGIC_MODEL_HEADER(x) LOGIC_STRINGIFY(x.h)
+
+#include LOGIC_MODEL_HEADER(LOGIC_MODEL)
+
+#if defined(LOGIC_BENCHMARK_VERILATED)
+#include <logic/verilated_loop.hpp>
+#include <logic/axi4/stream/bus_if_verilated.hpp>
+#else
+#include <logic/axi4/stream/harness.hpp>
+#endif
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#ifndef TDATA_BYTES
+#define TDATA_BYTES 4
+#endif
+
+#ifndef TUSER_WIDTH
+#define TUSER_WIDTH 1
+#endif
+
+#ifndef TDEST_WIDTH
+#define TDEST_WIDTH 1
+#endif
+
+#ifndef TID_WIDTH
+#define TID_WIDTH 1
+#endif
+
+#ifndef LOGIC_THREADS
+#define LOGIC_THREADS 1
+#endif
+
+/* Drive back-to-back transfers through any bus_if implementation */
+static void drive(logic::axi4::stream::bus_if_base& rx,
+        logic::axi4::stream::bus_if_base& tx,
+        sc_core::sc_signal<bool>& areset_n, std::uint64_t cycles) {
+    areset_n.write(false);
+    rx.aclk_posedge();
+    rx.aclk_posedge();
+    areset_n.write(true);
+
+    for (std::size_t i = 0u; i < rx.size(); ++i) {
+        rx.set_tkeep(i, true);
+        rx.set_tstrb(i, true);
+    }
+
+    rx.set_tvalid(true);
+    tx.set_tready(true);
+
+    for (std::uint64_t cycle = 0u; cycle < cycles; ++cycle) {
+        rx.set_tdata(cycle % rx.size(), std::uint8_t(cycle));
+        rx.set_tlast(0u == (cycle % 16u));
+        rx.aclk_posedge();
+    }
+
+    sc_core::sc_stop();
+}
+
+int sc_main(int argc, char* argv[]) {
+    std::uint64_t cycles{100000};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+
+        if (0 == arg.compare(0, 8, "+cycles=")) {
+            cycles = std::stoull(arg.substr(8));
+        }
+    }
+
+#if defined(LOGIC_BENCHMARK_VERILATED)
+    using bus_if = logic::axi4::stream::bus_if_verilated<
+            TDATA_BYTES,
+            TID_WIDTH,
+            TDEST_WIDTH,
+            TUSER_WIDTH
+        >;
+
+    sc_core::sc_signal<bool> areset_n{"areset_n"};
+
+    bus_if rx{"rx"};
+    bus_if tx{"tx"};
+
+    LOGIC_MODEL dut{"dut"};
+
+    logic::verilated_loop<LOGIC_MODEL> loop{"loop", dut, dut.aclk,
+        dut.areset_n};
+
+    LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND(rx, bus_if::RX, dut, rx);
+    LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND(tx, bus_if::TX, dut, tx);
+
+    loop.add(rx);
+    loop.add(tx);
+    loop.areset_n(areset_n);
+
+    const std::string mode{"native"};
+#else
+    logic::axi4::stream::harness<
+            LOGIC_MODEL,
+            TDATA_BYTES,
+            TID_WIDTH,
+            TDEST_WIDTH,
+            TUSER_WIDTH
+        > top{"dut"};
+
+    auto& rx = top.rx;
+    auto& tx = top.tx;
+    auto& areset_n = top.areset_n;
+
+    const std::string mode{"threads " + std::to_string(LOGIC_THREADS)};
+#endif
+
+    sc_core::sc_spawn(sc_bind([&] () {
+        drive(rx, tx, areset_n, cycles);
+    }), "driver");
+
+    const auto begin = std::chrono::steady_clock::now();
+
+    sc_core::sc_start();
+
+    const std::chrono::duration<double> elapsed{
+        std::chrono::steady_clock::now() - begin};
+
+#if defined(LOGIC_BENCHMARK_VERILATED)
+    dut.final();
+#endif
+
+    std::cout << LOGIC_MODEL_NAME(LOGIC_MODEL) << ": " << mode <<
+        ", cycles " << cycles << ", " <<
+        (double(cycles) / elapsed.count()) << " cycles/s" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/seed.hpp"
+#include "logic/axi4/stream/test.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+class jumbo_test : public logic::axi4::stream::test {
+public:
+    UVM_COMPONENT_UTILS(jumbo_test)
+
+    static constexpr std::size_t PACKETS{2};
+
+    using logic::axi4::stream::test::test;
+
+    jumbo_test(jumbo_test&&) = delete;
+
+    jumbo_test(const jumbo_test&) = delete;
+
+    jumbo_test& operator=(jumbo_test&&) = delete;
+
+    jumbo_test& operator=(const jumbo_test&) = delete;
+
+    ~jumbo_test() override = default;
+protected:
+    void build_phase(uvm::uvm_phase& phase) override {
+        logic::axi4::stream::test::build_phase(phase);
+
+        uvm::uvm_config_db<bool>::set(this, "*", "streaming", true);
+    }
+
+    void run_phase(uvm::uvm_phase& phase) override {
+        phase.raise_objection(this);
+
+        int length{1 << 22};
+
+        uvm::uvm_config_db<int>::get(this, "*", "jumbo_length", length);
+
+        std::mt19937 random_generator(logic::get_seed(get_full_name()));
+        std::uniform_int_distribution<unsigned> random_data{0, 0xFF};
+
+        m_sequence->reset->items.resize(1);
+        m_sequence->reset->items[0].duration = 1;
+        m_sequence->reset->items[0].idle = 0;
+
+        m_sequence->rx->items.resize(PACKETS);
+        m_sequence->tx->items.resize(PACKETS);
+
+        for (auto& item : m_sequence->rx->items) {
+            item.idle = {0, 3};
+            item.tdata.resize(std::size_t(std::max(length, 1)));
+            for (auto& data : item.tdata) {
+                data = std::uint8_t(random_data(random_generator));
+            }
+        }
+
+        for (auto& item : m_sequence->tx->items) {
+            item.idle = {0, 3};
+        }
+
+        m_sequence->start(m_testbench->sequencer);
+
+        phase.drop_objection(this);
+    }
+};
+
+} /* namespace */
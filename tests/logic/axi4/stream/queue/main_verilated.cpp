@@ -0,0 +1,116 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOGIC_MODEL
+#define LOGIC_MODEL logic_axi4_stream_queue_top_cc
+#endif
+
+#define LOGIC_STRINGIFY(x) #x
+#define LOGIC_MODEL_NAME(x) LOGIC_STRINGIFY(x)
+#define LOGIC_MODEL_HEADER(x) LOGIC_STRINGIFY(x.h)
+
+#include LOGIC_MODEL_HEADER(LOGIC_MODEL)
+
+#include <logic/command_line.hpp>
+#include <logic/test_server.hpp>
+#include <logic/verilated_loop.hpp>
+#if defined(LOGIC_VERILATOR_SAVABLE)
+#include <logic/verilated_checkpoint.hpp>
+#endif
+#include <logic/axi4/stream/bus_if_verilated.hpp>
+#include <logic/axi4/stream/reset_if.hpp>
+
+#include <uvm>
+#include <systemc>
+
+#ifndef TDATA_BYTES
+#define TDATA_BYTES 4
+#endif
+
+#ifndef TUSER_WIDTH
+#define TUSER_WIDTH 1
+#endif
+
+#ifndef TDEST_WIDTH
+#define TDEST_WIDTH 1
+#endif
+
+#ifndef TID_WIDTH
+#define TID_WIDTH 1
+#endif
+
+using bus_if = logic::axi4::stream::bus_if_verilated<
+        TDATA_BYTES,
+        TID_WIDTH,
+        TDEST_WIDTH,
+        TUSER_WIDTH
+    >;
+
+int sc_main(int argc, char* argv[]) {
+    logic::command_line{argc, argv};
+
+    logic::test_server server{argc, argv};
+
+    sc_core::sc_signal<bool> areset_n{"areset_n"};
+
+    bus_if rx{"rx"};
+    bus_if tx{"tx"};
+
+    logic::axi4::stream::reset_if reset{};
+
+    LOGIC_MODEL dut{LOGIC_MODEL_NAME(LOGIC_MODEL)};
+
+    logic::verilated_loop<LOGIC_MODEL> loop{"loop", dut, dut.aclk,
+        dut.areset_n};
+
+    LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND(rx, bus_if::RX, dut, rx);
+    LOGIC_AXI4_STREAM_BUS_IF_VERILATED_BIND(tx, bus_if::TX, dut, tx);
+
+    loop.add(rx);
+    loop.add(tx);
+
+#if defined(LOGIC_VERILATOR_SAVABLE)
+    logic::verilated_checkpoint<LOGIC_MODEL> checkpoint{dut.name(), dut};
+#endif
+
+    uvm::uvm_config_db<logic::axi4::stream::bus_if_base*>::set(
+            nullptr, "*.rx_agent.*", "vif", &rx);
+
+    uvm::uvm_config_db<logic::axi4::stream::bus_if_base*>::set(
+            nullptr, "*.tx_agent.*", "vif", &tx);
+
+    uvm::uvm_config_db<logic::axi4::stream::reset_if*>::set(
+            nullptr, "*.reset_agent.*", "vif", &reset);
+
+    uvm::uvm_config_db<bool>::set(nullptr, "*", "checks_enable", true);
+
+    reset.aclk(loop.aclk);
+    reset.areset_n(areset_n);
+
+    loop.areset_n(areset_n);
+
+    return server.run([&dut] () {
+        bool test_passed{false};
+
+        uvm::run_test();
+
+        dut.final();
+
+        uvm::uvm_config_db<bool>::get(nullptr, "*", "test_passed",
+                test_passed);
+
+        return test_passed;
+    });
+}
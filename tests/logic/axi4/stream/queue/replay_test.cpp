@@ -0,0 +1,79 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "logic/axi4/stream/test.hpp"
+#include "logic/axi4/stream/stimulus.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+class replay_test : public logic::axi4::stream::test {
+public:
+    UVM_COMPONENT_UTILS(replay_test)
+
+    using logic::axi4::stream::test::test;
+
+    replay_test(replay_test&&) = delete;
+
+    replay_test(const replay_test&) = delete;
+
+    replay_test& operator=(replay_test&&) = delete;
+
+    replay_test& operator=(const replay_test&) = delete;
+
+    ~replay_test() override = default;
+protected:
+    void run_phase(uvm::uvm_phase& phase) override {
+        phase.raise_objection(this);
+
+        std::string stimulus_filename;
+
+        if (!uvm::uvm_config_db<std::string>::get(this, "*",
+                    "stimulus_filename", stimulus_filename)) {
+            UVM_FATAL(get_name(), "Stimulus file is not set!"
+                    " Simulation aborted!");
+        }
+
+        std::size_t packets{0};
+
+        try {
+            packets = logic::axi4::stream::stimulus_reader{
+                stimulus_filename}.packets();
+        }
+        catch (const std::runtime_error& error) {
+            UVM_FATAL(get_name(), std::string{error.what()} +
+                    "! Simulation aborted!");
+        }
+
+        m_sequence->reset->items.resize(1);
+        m_sequence->reset->items[0].duration = 1;
+        m_sequence->reset->items[0].idle = 0;
+
+        m_sequence->rx->stimulus = stimulus_filename;
+        m_sequence->tx->items.resize(packets);
+
+        for (auto& item : m_sequence->tx->items) {
+            item.idle = {0, 3};
+        }
+
+        m_sequence->start(m_testbench->sequencer);
+
+        phase.drop_objection(this);
+    }
+};
+
+} /* namespace */
@@ -0,0 +1,76 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/bitstream.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using logic::bitstream;
+
+static constexpr std::array<std::uint8_t, 8> PATTERN{{
+    0xA5, 0x3D, 0x5B, 0xC3, 0x96, 0x69, 0x0F, 0xF0
+}};
+
+static bool pattern_bit(std::size_t index) {
+    return 0 != ((PATTERN[index / 8u] >> (index % 8u)) & 1u);
+}
+
+class logic_bitstream_test : public ::testing::TestWithParam<std::size_t> { };
+
+TEST_P(logic_bitstream_test, assign_from_memory) {
+    const std::size_t width = GetParam();
+    bitstream bits{width};
+
+    bits.assign(static_cast<const void*>(PATTERN.data()), width);
+
+    for (std::size_t i = 0u; i < width; ++i) {
+        EXPECT_EQ(pattern_bit(i), bool(bits[i])) << "bit " << i;
+    }
+}
+
+TEST_P(logic_bitstream_test, assign_keeps_upper_bits) {
+    const std::size_t width = GetParam();
+    const std::size_t assigned = width / 2u + 1u;
+    bitstream bits{width};
+
+    for (std::size_t i = 0u; i < width; ++i) {
+        bits[i] = true;
+    }
+
+    bits.assign(static_cast<const void*>(PATTERN.data()), assigned);
+
+    for (std::size_t i = 0u; i < width; ++i) {
+        EXPECT_EQ((i < assigned) ? pattern_bit(i) : true, bool(bits[i])) <<
+            "bit " << i;
+    }
+}
+
+TEST_P(logic_bitstream_test, round_trip) {
+    const std::size_t width = GetParam();
+    bitstream bits{width};
+    bitstream copy{width};
+
+    bits.assign(static_cast<const void*>(PATTERN.data()), width);
+    copy.assign(static_cast<const void*>(bits.data()), width);
+
+    EXPECT_EQ(bits, copy);
+}
+
+INSTANTIATE_TEST_CASE_P(widths, logic_bitstream_test,
+    ::testing::Values(1u, 7u, 8u, 9u, 12u, 16u, 17u, 31u, 33u, 63u));
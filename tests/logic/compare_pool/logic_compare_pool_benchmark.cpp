@@ -0,0 +1,171 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/axi4/stream/compare_pool.hpp>
+
+#include <systemc>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <time.h>
+
+using logic::axi4::stream::packet;
+using logic::axi4::stream::packet_diff;
+using logic::axi4::stream::compare_pool;
+using logic::axi4::stream::tdata_byte;
+
+using clock_type = std::chrono::steady_clock;
+
+static constexpr std::size_t BUS_SIZE{4};
+
+static double seconds(const clock_type::time_point& begin) {
+    return std::chrono::duration<double>{clock_type::now() - begin}.count();
+}
+
+/* CPU time of calling thread, workers are not included */
+static double thread_seconds() {
+    timespec value{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &value);
+    return double(value.tv_sec) + (double(value.tv_nsec) * 1e-9);
+}
+
+/* Packet as received by monitor: payload, tuser and timestamp per beat */
+static packet make_packet(std::size_t index, std::size_t size) {
+    packet value;
+
+    value.bus_size = BUS_SIZE;
+    value.tdata.resize(size);
+
+    for (std::size_t i = 0u; i < size; ++i) {
+        value.tdata[i] = tdata_byte{std::uint8_t(index + i)};
+    }
+
+    const auto beats = (size + BUS_SIZE - 1u) / BUS_SIZE;
+
+    value.tuser.assign(beats, logic::bitstream{1});
+    value.timestamps.assign(beats, sc_core::SC_ZERO_TIME);
+
+    return value;
+}
+
+/* Time spent on checking, packets are ready up front like after FIFO get.
+ * Wall time includes workers only on machines with fewer cores than
+ * threads, simulation thread time never does */
+static void measure(const std::string& name, std::size_t packets,
+        std::size_t size, std::size_t workers, std::size_t depth) {
+    std::vector<packet> expected;
+    std::vector<packet> actual;
+
+    for (std::size_t i = 0u; i < packets; ++i) {
+        expected.push_back(make_packet(i, size));
+        actual.push_back(make_packet(i, size));
+    }
+
+    std::size_t mismatches{0};
+    double elapsed{0};
+    double cpu{0};
+
+    const auto handler = [&mismatches] (compare_pool::job& value) {
+        if (!value.equal) {
+            ++mismatches;
+        }
+    };
+
+    if (0 == workers) {
+        packet_diff diff;
+
+        const auto cpu_begin = thread_seconds();
+        const auto begin = clock_type::now();
+
+        for (std::size_t i = 0u; i < packets; ++i) {
+            if (!diff.compare(expected[i], actual[i])) {
+                ++mismatches;
+            }
+        }
+
+        elapsed = seconds(begin);
+        cpu = thread_seconds() - cpu_begin;
+    }
+    else {
+        compare_pool pool{workers, depth, packet_diff{}};
+
+        const auto cpu_begin = thread_seconds();
+        const auto begin = clock_type::now();
+
+        for (std::size_t i = 0u; i < packets; ++i) {
+            auto slot = pool.acquire();
+
+            while (nullptr == slot) {
+                pool.collect(true, handler, 1);
+                slot = pool.acquire();
+            }
+
+            slot->expected = std::move(expected[i]);
+            slot->actual = std::move(actual[i]);
+
+            pool.submit();
+            pool.collect(false, handler);
+        }
+
+        pool.collect(true, handler);
+
+        elapsed = seconds(begin);
+        cpu = thread_seconds() - cpu_begin;
+    }
+
+    std::cout << name << ": workers " << workers << ", packets " <<
+        packets << ", size " << size << ", " <<
+        ((elapsed * 1e9) / double(packets)) << " ns/packet pair, " <<
+        ((cpu * 1e9) / double(packets)) << " ns/packet pair on "
+        "simulation thread" <<
+        ((0 == mismatches) ? "" : ", mismatch error") << std::endl;
+}
+
+int sc_main(int argc, char* argv[]) {
+    std::size_t packets{10000};
+    std::size_t size{1500};
+    std::size_t workers{2};
+    std::size_t depth{16};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+
+        if (0 == arg.compare(0, 9, "+packets=")) {
+            packets = std::stoul(arg.substr(9));
+        }
+        else if (0 == arg.compare(0, 6, "+size=")) {
+            size = std::max<std::size_t>(1u, std::stoul(arg.substr(6)));
+        }
+        else if (0 == arg.compare(0, 9, "+workers=")) {
+            workers = std::max<std::size_t>(1u, std::stoul(arg.substr(9)));
+        }
+        else if (0 == arg.compare(0, 7, "+depth=")) {
+            depth = std::max<std::size_t>(1u, std::stoul(arg.substr(7)));
+        }
+    }
+
+    measure("in place", packets, size, 0, depth);
+    measure("compare_pool", packets, size, workers, depth);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/axi4/stream/compare_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using logic::axi4::stream::packet;
+using logic::axi4::stream::packet_diff;
+using logic::axi4::stream::compare_pool;
+using logic::axi4::stream::tdata_byte;
+
+static constexpr std::size_t PACKETS{10000};
+
+static void make_packets(std::size_t index, packet& expected,
+        packet& actual) {
+    /* Bus size tags the pair, payload of matching pairs is freed */
+    expected.bus_size = 1u + (index % 97u);
+    expected.tdata.resize(1u + (index % 97u));
+
+    for (std::size_t i = 0u; i < expected.tdata.size(); ++i) {
+        expected.tdata[i] = tdata_byte{std::uint8_t(index + i)};
+    }
+
+    actual.bus_size = expected.bus_size;
+    actual.tdata = expected.tdata;
+
+    /* Every tenth pair mismatches on the first byte */
+    if (0u == (index % 10u)) {
+        actual.tdata[0] = tdata_byte{std::uint8_t(index + 1u)};
+    }
+}
+
+TEST(compare_pool, order) {
+    compare_pool pool{3, 4, packet_diff{}};
+    std::vector<std::size_t> tags;
+    std::size_t mismatches{0};
+
+    const auto handler = [&] (compare_pool::job& value) {
+        tags.push_back(value.expected.bus_size);
+        EXPECT_EQ(value.equal, value.expected.tdata.empty());
+
+        if (!value.equal) {
+            EXPECT_FALSE(value.report.empty());
+            ++mismatches;
+        }
+    };
+
+    packet expected;
+    packet actual;
+
+    for (std::size_t i = 0u; i < PACKETS; ++i) {
+        make_packets(i, expected, actual);
+
+        while (!pool.submit(std::move(expected), std::move(actual))) {
+            pool.collect(true, handler, 1);
+        }
+
+        pool.collect(false, handler);
+    }
+
+    pool.collect(true, handler);
+
+    EXPECT_EQ(0u, pool.pending());
+    EXPECT_EQ(PACKETS / 10u, mismatches);
+    ASSERT_EQ(PACKETS, tags.size());
+
+    for (std::size_t i = 0u; i < PACKETS; ++i) {
+        ASSERT_EQ(1u + (i % 97u), tags[i]);
+    }
+}
+
+TEST(compare_pool, full) {
+    compare_pool pool{1, 2, packet_diff{}};
+    std::vector<std::size_t> tags;
+
+    const auto handler = [&] (compare_pool::job& value) {
+        EXPECT_TRUE(value.equal);
+        tags.push_back(value.expected.bus_size);
+        EXPECT_EQ(value.equal, value.expected.tdata.empty());
+    };
+
+    packet expected;
+    packet actual;
+
+    for (std::size_t i = 1u; i <= 2u; ++i) {
+        make_packets(i, expected, actual);
+        EXPECT_TRUE(pool.submit(std::move(expected), std::move(actual)));
+    }
+
+    /* Slots are released only by collect, even when workers are done */
+    make_packets(3, expected, actual);
+    EXPECT_EQ(nullptr, pool.acquire());
+    EXPECT_FALSE(pool.submit(std::move(expected), std::move(actual)));
+    EXPECT_EQ(2u, pool.pending());
+
+    EXPECT_EQ(1u, pool.collect(true, handler, 1));
+    EXPECT_EQ(1u, pool.pending());
+
+    /* Failed submit leaves packets untouched, slot is filled in place */
+    auto slot = pool.acquire();
+    ASSERT_NE(nullptr, slot);
+    slot->expected = expected;
+    slot->actual = actual;
+    pool.submit();
+
+    EXPECT_EQ(2u, pool.collect(true, handler));
+    EXPECT_EQ(0u, pool.pending());
+    EXPECT_EQ(0u, pool.collect(true, handler));
+
+    ASSERT_EQ(3u, tags.size());
+
+    for (std::size_t i = 0u; i < tags.size(); ++i) {
+        EXPECT_EQ(2u + i, tags[i]);
+    }
+}
@@ -0,0 +1,178 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/mpsc_ring.hpp>
+#include <logic/spsc_ring.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+
+static double seconds(const clock_type::time_point& begin) {
+    return std::chrono::duration<double>{clock_type::now() - begin}.count();
+}
+
+template<typename Ring>
+static void produce(Ring& ring, std::uint64_t messages, std::size_t batch) {
+    std::vector<std::uint64_t> values(batch);
+
+    for (std::uint64_t sent = 0u; sent < messages; sent += batch) {
+        const auto count = std::size_t(std::min<std::uint64_t>(batch,
+                    messages - sent));
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            values[i] = sent + i;
+        }
+
+        ring.push(values.cbegin(), count);
+    }
+}
+
+template<typename Ring>
+static std::uint64_t consume(Ring& ring, std::uint64_t messages,
+        std::size_t batch) {
+    std::vector<std::uint64_t> values(batch);
+    std::uint64_t checksum{0};
+
+    for (std::uint64_t received = 0u; received < messages; ) {
+        const auto count = ring.pop(values.begin(), batch);
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            checksum += values[i];
+        }
+
+        received += count;
+    }
+
+    return checksum;
+}
+
+template<typename Ring>
+static void throughput(const std::string& name, std::size_t producers,
+        std::uint64_t messages, std::size_t batch, std::size_t capacity) {
+    Ring ring{capacity};
+    std::vector<std::thread> threads;
+
+    const auto begin = clock_type::now();
+
+    for (std::size_t i = 0u; i < producers; ++i) {
+        threads.emplace_back([&ring, messages, batch] {
+            produce(ring, messages, batch);
+        });
+    }
+
+    const auto total = producers * messages;
+    const auto checksum = consume(ring, total, batch);
+    const auto elapsed = seconds(begin);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto expected = producers * ((messages * (messages - 1u)) / 2u);
+
+    std::cout << name << ": producers " << producers << ", messages " <<
+        total << ", batch " << batch << ", " << (double(total) / elapsed) <<
+        " messages/s" << ((checksum == expected) ? "" : ", checksum error") <<
+        std::endl;
+}
+
+template<typename Ring>
+static void latency(const std::string& name, std::uint64_t round_trips) {
+    Ring ping{2};
+    Ring pong{2};
+
+    std::thread echo{[&] {
+        std::uint64_t value{0};
+
+        for (std::uint64_t i = 0u; i < round_trips; ++i) {
+            ping.pop(value);
+            pong.push(value);
+        }
+    }};
+
+    std::uint64_t value{0};
+
+    const auto begin = clock_type::now();
+
+    for (std::uint64_t i = 0u; i < round_trips; ++i) {
+        ping.push(i);
+        pong.pop(value);
+    }
+
+    const auto elapsed = seconds(begin);
+
+    echo.join();
+
+    std::cout << name << ": round trips " << round_trips << ", " <<
+        ((elapsed * 1e9) / double(round_trips)) << " ns/round trip" <<
+        std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t messages{1000000};
+    std::size_t batch{32};
+    std::size_t capacity{1024};
+    std::size_t producers{2};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+
+        if (0 == arg.compare(0, 10, "+messages=")) {
+            messages = std::stoull(arg.substr(10));
+        }
+        else if (0 == arg.compare(0, 7, "+batch=")) {
+            batch = std::max<std::size_t>(1u, std::stoul(arg.substr(7)));
+        }
+        else if (0 == arg.compare(0, 10, "+capacity=")) {
+            capacity = std::stoul(arg.substr(10));
+        }
+        else if (0 == arg.compare(0, 11, "+producers=")) {
+            producers = std::max<std::size_t>(1u, std::stoul(arg.substr(11)));
+        }
+    }
+
+    using spsc_spin = logic::spsc_ring<std::uint64_t, logic::spin_wait>;
+    using spsc_blocking = logic::spsc_ring<std::uint64_t,
+          logic::blocking_wait>;
+    using mpsc_spin = logic::mpsc_ring<std::uint64_t, logic::spin_wait>;
+    using mpsc_blocking = logic::mpsc_ring<std::uint64_t,
+          logic::blocking_wait>;
+
+    throughput<spsc_spin>("spsc_ring<spin_wait>", 1, messages, 1, capacity);
+    throughput<spsc_spin>("spsc_ring<spin_wait>", 1, messages, batch,
+            capacity);
+    throughput<spsc_blocking>("spsc_ring<blocking_wait>", 1, messages,
+            batch, capacity);
+    throughput<mpsc_spin>("mpsc_ring<spin_wait>", producers, messages,
+            batch, capacity);
+    throughput<mpsc_blocking>("mpsc_ring<blocking_wait>", producers,
+            messages, batch, capacity);
+
+    const auto round_trips = std::max<std::uint64_t>(1u, messages / 16u);
+
+    latency<spsc_spin>("spsc_ring<spin_wait>", round_trips);
+    latency<spsc_blocking>("spsc_ring<blocking_wait>", round_trips);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+/* Copyright 2018 Tymoteusz Blazejczyk
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logic/mpsc_ring.hpp>
+#include <logic/spsc_ring.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t MESSAGES{100000};
+static constexpr std::size_t PRODUCERS{4};
+
+template<typename Ring>
+static void spsc_transfer(std::size_t capacity, std::size_t batch) {
+    Ring ring{capacity};
+    std::vector<std::uint64_t> received;
+
+    received.reserve(MESSAGES);
+
+    std::thread consumer{[&] {
+        std::vector<std::uint64_t> buffer(batch);
+
+        while (received.size() < MESSAGES) {
+            const auto count = ring.pop(buffer.begin(), batch);
+            received.insert(received.end(), buffer.begin(),
+                    buffer.begin() + std::ptrdiff_t(count));
+        }
+    }};
+
+    std::vector<std::uint64_t> values(batch);
+
+    for (std::size_t sent = 0u; sent < MESSAGES; sent += batch) {
+        const auto count = std::min(batch, MESSAGES - sent);
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            values[i] = sent + i;
+        }
+
+        ring.push(values.cbegin(), count);
+    }
+
+    consumer.join();
+
+    ASSERT_EQ(MESSAGES, received.size());
+
+    for (std::size_t i = 0u; i < MESSAGES; ++i) {
+        ASSERT_EQ(i, received[i]);
+    }
+
+    EXPECT_TRUE(ring.empty());
+}
+
+template<typename Ring>
+static void mpsc_transfer(std::size_t capacity, std::size_t batch) {
+    Ring ring{capacity};
+    std::vector<std::thread> producers;
+
+    for (std::size_t id = 0u; id < PRODUCERS; ++id) {
+        producers.emplace_back([&ring, id, batch] {
+            std::vector<std::uint64_t> values(batch);
+
+            for (std::size_t sent = 0u; sent < MESSAGES; sent += batch) {
+                const auto count = std::min(batch, MESSAGES - sent);
+
+                for (std::size_t i = 0u; i < count; ++i) {
+                    values[i] = (std::uint64_t(id) << 32u) | (sent + i);
+                }
+
+                ring.push(values.cbegin(), count);
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> next(PRODUCERS, 0u);
+    std::vector<std::uint64_t> buffer(batch);
+    std::size_t received = 0u;
+    bool ordered = true;
+
+    while (received < (PRODUCERS * MESSAGES)) {
+        const auto count = ring.pop(buffer.begin(), batch);
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto id = std::size_t(buffer[i] >> 32u);
+            const auto sequence = buffer[i] & 0xFFFFFFFFu;
+
+            ordered = ordered && (id < PRODUCERS) && (next[id] == sequence);
+            ++next[id % PRODUCERS];
+        }
+
+        received += count;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(ring.empty());
+
+    for (const auto value : next) {
+        EXPECT_EQ(MESSAGES, value);
+    }
+}
+
+TEST(logic_ring_test, spsc_capacity) {
+    logic::spsc_ring<int> ring{5};
+
+    EXPECT_EQ(8u, ring.capacity());
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+
+    EXPECT_FALSE(ring.try_push(8));
+    EXPECT_EQ(8u, ring.size());
+
+    int value{-1};
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(i, value);
+    }
+
+    EXPECT_FALSE(ring.try_pop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(logic_ring_test, spsc_batch) {
+    logic::spsc_ring<int> ring{8};
+    const std::vector<int> values{0, 1, 2, 3, 4, 5};
+    std::vector<int> output(8, -1);
+
+    EXPECT_EQ(6u, ring.try_push(values.cbegin(), values.size()));
+    EXPECT_EQ(2u, ring.try_push(values.cbegin(), values.size()));
+    EXPECT_EQ(0u, ring.try_push(values.cbegin(), values.size()));
+
+    EXPECT_EQ(4u, ring.try_pop(output.begin(), 4));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, -1, -1, -1, -1}), output);
+
+    EXPECT_EQ(4u, ring.try_pop(output.begin(), 8));
+    EXPECT_EQ((std::vector<int>{4, 5, 0, 1, -1, -1, -1, -1}), output);
+
+    EXPECT_EQ(0u, ring.try_pop(output.begin(), 8));
+}
+
+TEST(logic_ring_test, spsc_move_only) {
+    logic::spsc_ring<std::unique_ptr<int>> ring{2};
+    std::unique_ptr<int> value{new int{7}};
+
+    EXPECT_TRUE(ring.try_push(std::move(value)));
+    EXPECT_TRUE(ring.try_pop(value));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(7, *value);
+}
+
+TEST(logic_ring_test, mpsc_capacity) {
+    logic::mpsc_ring<int> ring{3};
+    const std::vector<int> values{0, 1, 2};
+    std::vector<int> output(4, -1);
+
+    EXPECT_EQ(4u, ring.capacity());
+    EXPECT_EQ(3u, ring.try_push(values.cbegin(), values.size()));
+    EXPECT_TRUE(ring.try_push(3));
+    EXPECT_FALSE(ring.try_push(4));
+
+    EXPECT_EQ(4u, ring.try_pop(output.begin(), 8));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), output);
+    EXPECT_TRUE(ring.empty());
+
+    int value{-1};
+
+    EXPECT_TRUE(ring.try_push(5));
+    EXPECT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(5, value);
+    EXPECT_FALSE(ring.try_pop(value));
+}
+
+TEST(logic_ring_test, spsc_spin) {
+    spsc_transfer<logic::spsc_ring<std::uint64_t>>(64, 1);
+}
+
+TEST(logic_ring_test, spsc_spin_batch) {
+    spsc_transfer<logic::spsc_ring<std::uint64_t>>(64, 16);
+}
+
+TEST(logic_ring_test, spsc_blocking) {
+    spsc_transfer<logic::spsc_ring<std::uint64_t, logic::blocking_wait>>(
+            16, 1);
+}
+
+TEST(logic_ring_test, spsc_blocking_batch) {
+    spsc_transfer<logic::spsc_ring<std::uint64_t, logic::blocking_wait>>(
+            16, 7);
+}
+
+TEST(logic_ring_test, mpsc_spin) {
+    mpsc_transfer<logic::mpsc_ring<std::uint64_t>>(64, 1);
+}
+
+TEST(logic_ring_test, mpsc_spin_batch) {
+    mpsc_transfer<logic::mpsc_ring<std::uint64_t>>(64, 16);
+}
+
+TEST(logic_ring_test, mpsc_blocking) {
+    mpsc_transfer<logic::mpsc_ring<std::uint64_t, logic::blocking_wait>>(
+            16, 1);
+}
+
+TEST(logic_ring_test, mpsc_blocking_batch) {
+    mpsc_transfer<logic::mpsc_ring<std::uint64_t, logic::blocking_wait>>(
+            16, 5);
+}